@@ -0,0 +1,41 @@
+#ifndef __BENCH_HPP__
+#define __BENCH_HPP__
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <limits>
+
+namespace bench {
+
+    /*
+    * Prevents the optimizer from discarding the computation of value.
+    */
+    template<typename T>
+    inline void do_not_optimize(T const & value) {
+        asm volatile("" : : "r,m"(value) : "memory");
+    }
+
+
+    /*
+    * Runs f() `iterations` times per sample and returns the best
+    * (i.e. least disturbed) mean time of one call in nanoseconds.
+    */
+    template<typename Func>
+    double measure_ns(Func && f, std::size_t iterations, std::size_t samples = 5)
+    {
+        double best = std::numeric_limits<double>::max();
+        for (std::size_t s = 0; s < samples; ++s) {
+            auto start = std::chrono::steady_clock::now();
+            for (std::size_t i = 0; i < iterations; ++i)
+                f();
+            auto stop = std::chrono::steady_clock::now();
+            best = std::min(best,
+                std::chrono::duration<double, std::nano>(stop - start).count() / iterations);
+        }
+        return best;
+    }
+
+} // bench namespace
+
+#endif // __BENCH_HPP__
@@ -0,0 +1,290 @@
+/*
+* Compile-time cost benchmark for static_ranges.
+*
+* For every (operation, arity) pair a translation unit is generated that
+* applies the operation to a std::tuple of N distinct field types. Each
+* translation unit is compiled twice:
+*   1) with -fsyntax-only, which measures the front-end (parsing and
+*      template instantiation) time and peak RSS,
+*   2) with -c, which additionally yields the size of the object file.
+*
+* Results are written as CSV so instantiation cost regressions can be
+* tracked between revisions.
+*
+* usage:
+*
+* static_ranges_compile_bench --compiler g++ --include <repo root>
+*     --work <dir> --out <file.csv> [--arities 1,2,4,...] [--ops for_each,copy,...]
+*     [-- <extra compiler flags>]
+*/
+
+#include <fcntl.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+    namespace fs = std::filesystem;
+
+    struct measurement {
+        bool ok = false;
+        double wall_s = 0.0;
+        double cpu_s = 0.0;
+        long peak_rss_kb = 0;
+    };
+
+
+    /*
+    * The shared prologue of every generated translation unit. SR_BENCH_N
+    * is the arity of the range the operation is applied to.
+    */
+    constexpr const char * prologue = R"(#include "static_ranges.hpp"
+
+#include <cstddef>
+#include <tuple>
+#include <utility>
+
+template<std::size_t I>
+struct field {
+    int value = static_cast<int>(I);
+
+    field & operator = (int v) { value = v; return *this; }
+    operator int() const { return value; }
+};
+
+template<typename Indices>
+struct record_of;
+
+template<std::size_t ... I>
+struct record_of<std::index_sequence<I ...>> {
+    using type = std::tuple<field<I> ...>;
+};
+
+using record = typename record_of<std::make_index_sequence<SR_BENCH_N>>::type;
+
+)";
+
+
+    /*
+    * The body of every benchmarked operation. Each one defines an externally
+    * visible function, so the optimizer cannot discard the instantiations.
+    */
+    const std::vector<std::pair<std::string, std::string>> operations = {
+        { "baseline", R"(
+int bench_entry(record & r) {
+    return std::get<0>(r).value;
+}
+)" },
+        { "for_each", R"(
+int bench_entry(record & r) {
+    int sum = 0;
+    static_ranges::for_each(r, [&](auto & e) { sum += e.value; });
+    return sum;
+}
+)" },
+        { "copy", R"(
+int bench_entry(record & r) {
+    record dest;
+    static_ranges::copy(r, dest);
+    return std::get<0>(dest).value;
+}
+)" },
+        { "transform", R"(
+int bench_entry(record & r) {
+    record dest;
+    static_ranges::transform(r, dest, [](auto const & e) { return e.value + 1; });
+    static_ranges::transform(r, dest, dest, [](auto const & a, auto const & b) { return a.value + b.value; });
+    return std::get<0>(dest).value;
+}
+)" },
+        { "to_tuple", R"(
+int bench_entry(record & r) {
+    auto t = static_ranges::to_tuple(r);
+    return std::get<0>(t).value;
+}
+)" },
+        { "to_array", R"(
+int bench_entry(record & r) {
+    auto a = static_ranges::to_array<int>(r);
+    return a[0];
+}
+)" },
+        { "views_transform", R"(
+int bench_entry(record & r) {
+    auto v = r | static_views::transform([](auto const & e) { return e.value + 1; })
+               | static_views::transform([](int x) { return x * 2; })
+               | static_views::transform([](int x) { return x - 3; });
+    int sum = 0;
+    static_ranges::for_each(v, [&](int x) { sum += x; });
+    return sum;
+}
+)" },
+    };
+
+
+    /*
+    * Run the command and wait for it. Uses wait4 so that the resource usage
+    * includes the compiler proper (cc1plus and friends) spawned by the driver.
+    * Diagnostics of the compiler are redirected to the log file.
+    */
+    measurement run(const std::vector<std::string> & args, const fs::path & log)
+    {
+        std::vector<char *> argv;
+        for (auto & a : args)
+            argv.push_back(const_cast<char *>(a.c_str()));
+        argv.push_back(nullptr);
+
+        auto start = std::chrono::steady_clock::now();
+
+        pid_t pid = fork();
+        if (pid < 0)
+            return {};
+
+        if (pid == 0) {
+            int fd = open(log.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+            if (fd >= 0) {
+                dup2(fd, STDOUT_FILENO);
+                dup2(fd, STDERR_FILENO);
+                close(fd);
+            }
+            execvp(argv[0], argv.data());
+            _exit(127);
+        }
+
+        int status = 0;
+        rusage usage{};
+        if (wait4(pid, &status, 0, &usage) < 0)
+            return {};
+
+        auto stop = std::chrono::steady_clock::now();
+
+        auto seconds = [](const timeval & tv) {
+            return static_cast<double>(tv.tv_sec) + static_cast<double>(tv.tv_usec) / 1e6;
+        };
+
+        measurement m;
+        m.ok = WIFEXITED(status) && WEXITSTATUS(status) == 0;
+        m.wall_s = std::chrono::duration<double>(stop - start).count();
+        m.cpu_s = seconds(usage.ru_utime) + seconds(usage.ru_stime);
+        m.peak_rss_kb = usage.ru_maxrss;
+        return m;
+    }
+
+
+    std::vector<std::string> split(const std::string & s, char sep)
+    {
+        std::vector<std::string> parts;
+        std::stringstream ss(s);
+        for (std::string part; std::getline(ss, part, sep);)
+            if (!part.empty())
+                parts.push_back(part);
+        return parts;
+    }
+
+
+    [[noreturn]] void usage(const char * argv0)
+    {
+        std::cerr << "usage: " << argv0
+                  << " --compiler <cxx> --include <dir> --work <dir> --out <csv>"
+                     " [--arities N,...] [--ops op,...] [-- flags...]\n";
+        std::exit(2);
+    }
+
+} // anonymous namespace
+
+
+int main(int argc, char ** argv)
+{
+    std::string compiler, include_dir, out_path;
+    fs::path work_dir;
+    std::vector<std::string> arities = split("1,2,4,8,16,32,64,128,256,512,1024", ',');
+    std::vector<std::string> ops;
+    std::vector<std::string> extra_flags;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto next = [&]() -> std::string {
+            if (i + 1 >= argc)
+                usage(argv[0]);
+            return argv[++i];
+        };
+
+        if (arg == "--compiler") compiler = next();
+        else if (arg == "--include") include_dir = next();
+        else if (arg == "--work") work_dir = next();
+        else if (arg == "--out") out_path = next();
+        else if (arg == "--arities") arities = split(next(), ',');
+        else if (arg == "--ops") ops = split(next(), ',');
+        else if (arg == "--") {
+            extra_flags.assign(argv + i + 1, argv + argc);
+            break;
+        }
+        else usage(argv[0]);
+    }
+
+    if (compiler.empty() || include_dir.empty() || work_dir.empty() || out_path.empty())
+        usage(argv[0]);
+
+    fs::create_directories(work_dir);
+    std::ofstream out(out_path);
+    out << "operation,arity,status,frontend_wall_s,frontend_cpu_s,frontend_peak_rss_kb,"
+           "compile_wall_s,compile_cpu_s,compile_peak_rss_kb,object_bytes\n";
+
+    for (auto & [name, body] : operations) {
+        if (!ops.empty() && std::find(ops.begin(), ops.end(), name) == ops.end())
+            continue;
+
+        for (auto & n : arities) {
+            fs::path source = work_dir / (name + "_" + n + ".cpp");
+            fs::path object = work_dir / (name + "_" + n + ".o");
+            fs::path log = work_dir / (name + "_" + n + ".log");
+            {
+                std::ofstream tu(source);
+                tu << "#define SR_BENCH_N " << n << "\n" << prologue << body;
+            }
+
+            std::vector<std::string> cmd = { compiler, "-std=c++20", "-I", include_dir };
+            cmd.insert(cmd.end(), extra_flags.begin(), extra_flags.end());
+
+            auto frontend_cmd = cmd;
+            frontend_cmd.insert(frontend_cmd.end(), { "-fsyntax-only", source.string() });
+            auto frontend = run(frontend_cmd, log);
+
+            measurement full;
+            std::uintmax_t object_bytes = 0;
+            if (frontend.ok) {
+                auto full_cmd = cmd;
+                full_cmd.insert(full_cmd.end(), { "-c", source.string(), "-o", object.string() });
+                full = run(full_cmd, log);
+                if (full.ok)
+                    object_bytes = fs::file_size(object);
+            }
+
+            const char * status = !frontend.ok ? "frontend_error" : !full.ok ? "compile_error" : "ok";
+
+            out << name << ',' << n << ',' << status << ','
+                << frontend.wall_s << ',' << frontend.cpu_s << ',' << frontend.peak_rss_kb << ','
+                << full.wall_s << ',' << full.cpu_s << ',' << full.peak_rss_kb << ','
+                << object_bytes << '\n';
+            out.flush();
+
+            std::cout << name << " N=" << n << ": " << status
+                      << " frontend " << frontend.cpu_s << "s " << frontend.peak_rss_kb << "KB"
+                      << ", object " << object_bytes << "B" << std::endl;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,99 @@
+/*
+* Compares std::unordered_map insert and lookup throughput with
+* static_ranges::hasher and with the usual hand-written boost-style
+* hash_combine over the elements of the key.
+*/
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <random>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include "static_ranges.hpp"
+#include "bench.hpp"
+
+namespace {
+
+    struct boost_hasher
+    {
+        template<typename T>
+        static void hash_combine(std::size_t & seed, const T & v) {
+            seed ^= std::hash<T>{}(v) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+        }
+
+        template<typename Range>
+        std::size_t operator()(const Range & r) const {
+            std::size_t seed = 0;
+            static_ranges::for_each(r, [&seed](const auto & e) { hash_combine(seed, e); });
+            return seed;
+        }
+    };
+
+
+    template<typename Key, typename Hash>
+    void run(const char * name, const char * hash_name, const std::vector<Key> & keys)
+    {
+        std::unordered_map<Key, std::uint32_t, Hash> map;
+
+        double insert = bench::measure_ns([&] {
+            map.clear();
+            for (std::uint32_t i = 0; i < keys.size(); ++i)
+                map.emplace(keys[i], i);
+        }, 1, 3) / keys.size();
+
+        double lookup = bench::measure_ns([&] {
+            std::uint64_t sum = 0;
+            for (auto & key : keys)
+                sum += map.find(key)->second;
+            bench::do_not_optimize(sum);
+        }, 1, 3) / keys.size();
+
+        std::printf("%-28s %-14s %12.2f %12.2f\n", name, hash_name, insert, lookup);
+    }
+
+
+    template<typename Key, typename Make>
+    void run_both(const char * name, std::size_t n, Make make)
+    {
+        std::mt19937_64 gen(42);
+        std::vector<Key> keys;
+        keys.reserve(n);
+        for (std::size_t i = 0; i < n; ++i)
+            keys.push_back(make(gen));
+
+        run<Key, static_ranges::hasher>(name, "hasher", keys);
+        run<Key, boost_hasher>(name, "hash_combine", keys);
+    }
+
+} // anonymous namespace
+
+
+int main()
+{
+    const std::size_t n = 1000000;
+
+    std::printf("%-28s %-14s %12s %12s\n", "key", "hash", "insert ns", "lookup ns");
+
+    // small integers, the typical composite key; identity std::hash makes
+    // the combining scheme decide the quality of the hash
+    run_both<std::tuple<int, int, int>>("tuple<int, int, int>", n, [](auto & gen) {
+        return std::make_tuple(
+            static_cast<int>(gen() % 128), static_cast<int>(gen() % 128), static_cast<int>(gen() % 128));
+    });
+
+    run_both<std::array<std::uint32_t, 8>>("array<uint32_t, 8>", n, [](auto & gen) {
+        std::array<std::uint32_t, 8> a;
+        for (auto & v : a)
+            v = static_cast<std::uint32_t>(gen() % 1024);
+        return a;
+    });
+
+    run_both<std::tuple<std::uint64_t, std::string>>("tuple<uint64_t, string>", n, [](auto & gen) {
+        return std::make_tuple(gen() % 4096, std::to_string(gen() % 4096));
+    });
+}
@@ -0,0 +1,173 @@
+/*
+* Compares the sequential for_each and transform with the execution::par
+* versions (shared counter and work stealing) on tuples of heavyweight,
+* heterogeneous elements, then measures where the parallel policy starts to
+* pay off for light elements, which is what the default sequential threshold
+* of execution::par is based on.
+*/
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "static_ranges.hpp"
+#include "include/execution.hpp"
+#include "bench.hpp"
+
+namespace {
+
+    namespace ex = static_ranges::execution;
+
+    /*
+    * A model shard: a distinct type per index, with uneven amounts of work
+    * (shards with odd index are twice as expensive).
+    */
+    template<std::size_t I>
+    struct shard {
+        std::vector<double> weights = std::vector<double>(20000 * (1 + I % 2), 1.0 + I);
+
+        double run() const {
+            double acc = 0.0;
+            for (double w : weights)
+                acc += std::sqrt(w * acc + 1.0);
+            return acc;
+        }
+    };
+
+    template<typename Indices>
+    struct shards_of;
+
+    template<std::size_t ... I>
+    struct shards_of<std::index_sequence<I ...>> {
+        using type = std::tuple<shard<I> ...>;
+        using results = std::array<double, sizeof...(I)>;
+    };
+
+
+    template<std::size_t N>
+    void run()
+    {
+        using of = shards_of<std::make_index_sequence<N>>;
+        typename of::type shards;
+        typename of::results results{};
+
+        auto work = [](auto const & s) { return s.run(); };
+        auto visit = [](auto const & s) { bench::do_not_optimize(s.run()); };
+
+        // the shards are heavy enough to be worth the pool from 2 elements on
+        auto heavy = ex::par.with_sequential_threshold(2);
+
+        const std::size_t iterations = 8;
+
+        double seq = bench::measure_ns([&] { static_ranges::for_each(shards, visit); }, iterations);
+        double par = bench::measure_ns([&] { static_ranges::for_each(heavy, shards, visit); }, iterations);
+        double steal = bench::measure_ns([&] {
+            static_ranges::for_each(heavy.with_work_stealing(), shards, visit);
+        }, iterations);
+
+        double seq_t = bench::measure_ns([&] { static_ranges::transform(shards, results, work); }, iterations);
+        double par_t = bench::measure_ns([&] { static_ranges::transform(heavy, shards, results, work); }, iterations);
+        bench::do_not_optimize(results);
+
+        std::printf("%5zu %14.1f %14.1f %14.1f %8.2fx %14.1f %14.1f %8.2fx\n",
+            N, seq / 1e3, par / 1e3, steal / 1e3, seq / std::min(par, steal),
+            seq_t / 1e3, par_t / 1e3, seq_t / par_t);
+    }
+
+
+    /*
+    * A light element: `Work` dependent square roots, i.e. roughly Work * 5 ns.
+    */
+    template<std::size_t I, std::size_t Work>
+    struct light {
+        double seed = 1.0 + I;
+
+        double run() const {
+            double acc = seed;
+            for (std::size_t i = 0; i < Work; ++i)
+                acc = std::sqrt(acc + 1.0);
+            return acc;
+        }
+    };
+
+    template<typename Indices, std::size_t Work>
+    struct lights_of;
+
+    template<std::size_t ... I, std::size_t Work>
+    struct lights_of<std::index_sequence<I ...>, Work> {
+        using type = std::tuple<light<I, Work> ...>;
+    };
+
+
+    /*
+    * Ratio of the sequential to the parallel time of for_each over N light
+    * elements, with the sequential threshold disabled; above 1 the pool pays off.
+    */
+    template<std::size_t N, std::size_t Work>
+    double light_speedup()
+    {
+        typename lights_of<std::make_index_sequence<N>, Work>::type lights;
+        auto visit = [](auto const & l) { bench::do_not_optimize(l.run()); };
+        auto always = ex::par.with_sequential_threshold(0);
+
+        const std::size_t iterations = 2000;
+
+        double seq = bench::measure_ns([&] { static_ranges::for_each(lights, visit); }, iterations);
+        double par = bench::measure_ns([&] { static_ranges::for_each(always, lights, visit); }, iterations);
+        return seq / par;
+    }
+
+
+    /*
+    * Time of a parallel for_each over N elements which do nothing, i.e. the
+    * cost of waking the pool and joining it.
+    */
+    template<std::size_t N>
+    double dispatch_ns()
+    {
+        typename lights_of<std::make_index_sequence<N>, 0>::type lights;
+        auto always = ex::par.with_sequential_threshold(0);
+        return bench::measure_ns([&] {
+            static_ranges::for_each(always, lights, [](auto const & l) { bench::do_not_optimize(l); });
+        }, 2000);
+    }
+
+
+    template<std::size_t Work>
+    void run_light()
+    {
+        std::printf("%8zu %8.2fx %8.2fx %8.2fx %8.2fx %8.2fx\n", Work,
+            light_speedup<2, Work>(), light_speedup<4, Work>(), light_speedup<8, Work>(),
+            light_speedup<16, Work>(), light_speedup<32, Work>());
+    }
+
+} // anonymous namespace
+
+
+int main()
+{
+    std::printf("pool threads: %zu (+ calling thread)\n", ex::thread_pool::instance().size());
+    std::printf("%5s %14s %14s %14s %9s %14s %14s %9s\n",
+        "N", "for_each us", "par us", "par+steal us", "speedup",
+        "transform us", "par us", "speedup");
+
+    run<1>();
+    run<2>();
+    run<4>();
+    run<8>();
+    run<16>();
+    run<64>();
+
+    std::printf("\nfork/join of par over 4 empty elements: %.2f us\n", dispatch_ns<4>() / 1e3);
+    std::printf("speedup of par over sequential for_each on light elements\n");
+    std::printf("%8s %9s %9s %9s %9s %9s\n", "work", "N=2", "N=4", "N=8", "N=16", "N=32");
+
+    run_light<16>();
+    run_light<64>();
+    run_light<256>();
+    run_light<1024>();
+}
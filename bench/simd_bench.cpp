@@ -0,0 +1,74 @@
+/*
+* Compares, for std::array<float, N>, the element-by-element transform_impl
+* expansion with the run-time loop transform uses for contiguous ranges and
+* with the vectorized kernels of transform(execution::unseq, ...).
+*/
+
+#include <array>
+#include <cstdio>
+
+#include "static_ranges.hpp"
+#include "include/simd.hpp"
+#include "bench.hpp"
+
+namespace {
+
+    namespace ex = static_ranges::execution;
+
+    template<std::size_t N>
+    void run()
+    {
+        using range = std::array<float, N>;
+        using indices = std::make_index_sequence<N>;
+
+        range a, b, c;
+        for (std::size_t i = 0; i < N; ++i) {
+            a[i] = static_cast<float>(i);
+            b[i] = static_cast<float>(N - i);
+        }
+
+        auto one = [](auto x) { return x * 1.5f + 2.0f; };
+        auto two = [](auto x, auto y) { return (x + y) * 0.5f; };
+
+        const std::size_t iterations = 1 + (1 << 22) / N;
+
+        auto measure = [&](auto && call) {
+            return bench::measure_ns([&] {
+                call();
+                bench::do_not_optimize(c.data());
+            }, iterations);
+        };
+
+        double elementwise = measure([&] { static_ranges::transform_impl<indices>::call_two(a, c, one); });
+        double loop = measure([&] { static_ranges::transform(a, c, one); });
+        double simd = measure([&] { static_ranges::transform(ex::unseq, a, c, one); });
+
+        double elementwise3 = measure([&] { static_ranges::transform_impl<indices>::call_three(a, b, c, two); });
+        double loop3 = measure([&] { static_ranges::transform(a, b, c, two); });
+        double simd3 = measure([&] { static_ranges::transform(ex::unseq, a, b, c, two); });
+
+        std::printf("%5zu %12.1f %12.1f %12.1f %8.2fx %12.1f %12.1f %12.1f %8.2fx\n",
+            N, elementwise, loop, simd, elementwise / simd,
+            elementwise3, loop3, simd3, elementwise3 / simd3);
+    }
+
+} // anonymous namespace
+
+
+int main()
+{
+    std::printf("%5s %12s %12s %12s %9s %12s %12s %12s %9s\n",
+        "N", "element ns", "loop ns", "unseq ns", "speedup",
+        "element3 ns", "loop3 ns", "unseq3 ns", "speedup");
+
+    run<8>();
+    run<16>();
+    run<32>();
+    run<64>();
+    run<128>();
+    run<256>();
+    run<512>();
+    run<1024>();
+    run<2048>();
+    run<4096>();
+}
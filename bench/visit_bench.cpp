@@ -0,0 +1,133 @@
+/*
+* Compares visit_at, which dispatches through a table of per-index
+* functions, with the linear if-chain over element<I> it replaces.
+*/
+
+#include <array>
+#include <cstdio>
+#include <random>
+#include <type_traits>
+#include <utility>
+
+#include "static_ranges.hpp"
+#include "bench.hpp"
+
+namespace {
+
+    template<std::size_t I>
+    struct field {
+        int value;
+    };
+
+    /*
+    * A record of N fields of distinct types. It is a static range of its own
+    * rather than a std::tuple<field<I> ...>, whose element access alone takes
+    * minutes to compile at 512 elements with libstdc++.
+    */
+    template<std::size_t N>
+    struct record {
+        std::array<int, N> values;
+
+        record() {
+            for (std::size_t i = 0; i < N; ++i)
+                values[i] = static_cast<int>(i);
+        }
+    };
+
+} // anonymous namespace
+
+
+namespace static_ranges {
+
+    template<std::size_t N>
+    struct range_traits<record<N>>
+        : std::integral_constant<std::size_t, N>
+    {
+        template<std::size_t I>
+        static constexpr field<I> get(const record<N> & r)
+        {
+            return { r.values[I] };
+        }
+    };
+
+} // static_ranges namespace
+
+
+namespace {
+
+    /*
+    * The if-chain i == 0, i == 1, ... over element<I>. The chain is built
+    * by splitting the index range in halves, which keeps the template
+    * recursion at log2(N) levels and compiles fast up to 512 elements.
+    * A flat fold expression did not.
+    */
+    template<std::size_t Begin, std::size_t End, typename Range, typename Func>
+    bool if_chain(Range & r, std::size_t i, Func & f, int & result)
+    {
+        if constexpr (End - Begin == 1) {
+            if (i != Begin)
+                return false;
+            result = f(static_ranges::element<Begin>(r));
+            return true;
+        }
+        else {
+            constexpr std::size_t Mid = Begin + (End - Begin) / 2;
+            return if_chain<Begin, Mid>(r, i, f, result) || if_chain<Mid, End>(r, i, f, result);
+        }
+    }
+
+    template<std::size_t N, typename Range, typename Func>
+    int if_chain(Range & r, std::size_t i, Func & f)
+    {
+        int result = -1;
+        if_chain<0, N>(r, i, f, result);
+        return result;
+    }
+
+
+    template<std::size_t N>
+    void run(const std::array<std::size_t, 4096> & ids)
+    {
+        record<N> fields;
+        auto read = [](auto const & e) { return e.value; };
+
+        const std::size_t iterations = 2000;
+
+        double table = bench::measure_ns([&] {
+            int sum = 0;
+            for (std::size_t id : ids)
+                sum += static_ranges::visit_at(std::as_const(fields), id % N, read);
+            bench::do_not_optimize(sum);
+        }, iterations) / ids.size();
+
+        double chain = bench::measure_ns([&] {
+            int sum = 0;
+            for (std::size_t id : ids)
+                sum += if_chain<N>(std::as_const(fields), id % N, read);
+            bench::do_not_optimize(sum);
+        }, iterations) / ids.size();
+
+        std::printf("%5zu %14.2f %14.2f %9.2fx\n", N, table, chain, chain / table);
+    }
+
+} // anonymous namespace
+
+
+int main()
+{
+    std::array<std::size_t, 4096> ids;
+    std::mt19937_64 gen(42);
+    for (auto & id : ids)
+        id = gen();
+
+    std::printf("%5s %14s %14s %10s\n", "N", "visit_at ns", "if-chain ns", "speedup");
+
+    run<4>(ids);
+    run<8>(ids);
+    run<16>(ids);
+    run<32>(ids);
+    run<64>(ids);
+    run<128>(ids);
+    run<256>(ids);
+    run<512>(ids);
+}
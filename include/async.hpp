@@ -0,0 +1,563 @@
+#ifndef __ASYNC_HPP__
+#define __ASYNC_HPP__
+
+/*
+* Coroutine algorithms over static ranges of awaitables, and a small
+* executor. Not included by static_ranges.hpp, since <coroutine>, <thread>
+* and <atomic> are costly to parse.
+*/
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <coroutine>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <optional>
+#include <queue>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "range_traits.hpp"
+#include "convenience.hpp"
+#include "concepts.hpp"
+
+namespace static_ranges {
+
+    template<typename T = void>
+    class task;
+
+
+    struct task_promise_base
+    {
+        /*
+        * Resumes the awaiting coroutine once the task is done, by symmetric
+        * transfer, so chains of tasks do not grow the stack.
+        */
+        struct final_awaiter
+        {
+            bool await_ready() const noexcept { return false; }
+
+            template<typename Promise>
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> h) noexcept {
+                return h.promise().m_continuation;
+            }
+
+            void await_resume() const noexcept {}
+        };
+
+        std::suspend_always initial_suspend() const noexcept { return {}; }
+        final_awaiter final_suspend() const noexcept { return {}; }
+
+        void unhandled_exception() noexcept {
+            m_exception = std::current_exception();
+        }
+
+        std::coroutine_handle<> m_continuation = std::noop_coroutine();
+        std::exception_ptr m_exception;
+    };
+
+
+    template<typename T>
+    struct task_promise : task_promise_base
+    {
+        task<T> get_return_object() noexcept;
+
+        template<typename U>
+        void return_value(U && value) {
+            m_value.emplace(std::forward<U>(value));
+        }
+
+        T result() {
+            if (m_exception)
+                std::rethrow_exception(m_exception);
+            return std::move(*m_value);
+        }
+
+        std::optional<T> m_value;
+    };
+
+    template<>
+    struct task_promise<void> : task_promise_base
+    {
+        task<void> get_return_object() noexcept;
+
+        void return_void() const noexcept {}
+
+        void result() {
+            if (m_exception)
+                std::rethrow_exception(m_exception);
+        }
+    };
+
+
+    /*
+    * A lazily started coroutine producing a T: its body runs when the task
+    * is awaited, and the awaiting coroutine is resumed with the result
+    * (or the exception) once the body completes.
+    *
+    * example:
+    *
+    * static_ranges::task<int> twice(int x) {
+    *     co_await executor.schedule();
+    *     co_return 2 * x;
+    * }
+    */
+    template<typename T>
+    class [[nodiscard]] task
+    {
+    public:
+
+        using promise_type = task_promise<T>;
+
+        explicit task(std::coroutine_handle<promise_type> handle) noexcept
+            : m_handle(handle) {}
+
+        task(task && other) noexcept
+            : m_handle(std::exchange(other.m_handle, {})) {}
+
+        task & operator = (task && other) noexcept {
+            if (this != &other) {
+                if (m_handle)
+                    m_handle.destroy();
+                m_handle = std::exchange(other.m_handle, {});
+            }
+            return *this;
+        }
+
+        ~task() {
+            if (m_handle)
+                m_handle.destroy();
+        }
+
+        auto operator co_await() && noexcept {
+            struct awaiter
+            {
+                bool await_ready() const noexcept {
+                    return m_handle.done();
+                }
+
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<> continuation) noexcept {
+                    m_handle.promise().m_continuation = continuation;
+                    return m_handle;
+                }
+
+                T await_resume() {
+                    return m_handle.promise().result();
+                }
+
+                std::coroutine_handle<promise_type> m_handle;
+            };
+            return awaiter{ m_handle };
+        }
+
+    private:
+
+        std::coroutine_handle<promise_type> m_handle;
+    };
+
+    template<typename T>
+    task<T> task_promise<T>::get_return_object() noexcept {
+        return task<T>(std::coroutine_handle<task_promise>::from_promise(*this));
+    }
+
+    inline task<void> task_promise<void>::get_return_object() noexcept {
+        return task<void>(std::coroutine_handle<task_promise>::from_promise(*this));
+    }
+
+
+    /*
+    * The awaiter obtained when awaiting an A, and the type of co_await a.
+    */
+    template<typename A>
+    decltype(auto) get_awaiter(A && a) {
+        if constexpr (requires { std::forward<A>(a).operator co_await(); })
+            return std::forward<A>(a).operator co_await();
+        else if constexpr (requires { operator co_await(std::forward<A>(a)); })
+            return operator co_await(std::forward<A>(a));
+        else
+            return std::forward<A>(a);
+    }
+
+    template<typename A>
+    using await_result_t = decltype(get_awaiter(std::declval<A>()).await_resume());
+
+
+    /*
+    * The join point of a group of concurrently started awaitables: the count
+    * of the ones still running, plus one for the starter itself, so the
+    * continuation is resumed only after every one is started and completed.
+    */
+    struct when_all_state
+    {
+        explicit when_all_state(std::size_t count) noexcept
+            : m_count(count) {}
+
+        bool release() noexcept {
+            return m_count.fetch_sub(1, std::memory_order_acq_rel) == 1;
+        }
+
+        std::atomic<std::size_t> m_count;
+        std::coroutine_handle<> m_continuation = std::noop_coroutine();
+    };
+
+
+    /*
+    * The coroutine awaiting one awaitable of a group; it is started by
+    * start() and signals the group state when done. The exception it ends
+    * with, if any, is kept for the starter to rethrow.
+    */
+    class when_all_child
+    {
+    public:
+
+        struct promise_type
+        {
+            struct final_awaiter
+            {
+                bool await_ready() const noexcept { return false; }
+
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> h) noexcept {
+                    when_all_state & state = *h.promise().m_state;
+                    return state.release() ? state.m_continuation : std::noop_coroutine();
+                }
+
+                void await_resume() const noexcept {}
+            };
+
+            when_all_child get_return_object() noexcept {
+                return when_all_child(std::coroutine_handle<promise_type>::from_promise(*this));
+            }
+
+            std::suspend_always initial_suspend() const noexcept { return {}; }
+            final_awaiter final_suspend() const noexcept { return {}; }
+
+            void return_void() const noexcept {}
+
+            void unhandled_exception() noexcept {
+                m_exception = std::current_exception();
+            }
+
+            when_all_state * m_state = nullptr;
+            std::exception_ptr m_exception;
+        };
+
+        explicit when_all_child(std::coroutine_handle<promise_type> handle) noexcept
+            : m_handle(handle) {}
+
+        when_all_child(when_all_child && other) noexcept
+            : m_handle(std::exchange(other.m_handle, {})) {}
+
+        when_all_child & operator = (when_all_child &&) = delete;
+
+        ~when_all_child() {
+            if (m_handle)
+                m_handle.destroy();
+        }
+
+        void start(when_all_state & state) {
+            m_handle.promise().m_state = &state;
+            m_handle.resume();
+        }
+
+        bool done() const noexcept {
+            return m_handle.done();
+        }
+
+        void rethrow_if_failed() const {
+            if (m_handle.promise().m_exception)
+                std::rethrow_exception(m_handle.promise().m_exception);
+        }
+
+    private:
+
+        std::coroutine_handle<promise_type> m_handle;
+    };
+
+
+    /*
+    * Awaits awaitable, discarding its result. The awaitable is moved into the
+    * coroutine frame, unless Awaitable is given explicitly as a reference type:
+    * then the referenced awaitable, which must outlive the coroutine, is
+    * awaited in place, so it need not be movable.
+    * The awaiter is awaited as a named lvalue: GCC copies the awaiter of a
+    * co_await on an xvalue, which does not compile for immovable ones.
+    */
+    template<typename Awaitable>
+    when_all_child make_when_all_child(Awaitable awaitable) {
+        auto && awaiter = get_awaiter(std::forward<Awaitable>(awaitable));
+        co_await awaiter;
+    }
+
+    /*
+    * Awaits awaitable and assigns its result to dest. Awaitable is handled
+    * as above.
+    */
+    template<typename Awaitable, typename Dest>
+    when_all_child make_when_all_child(Awaitable awaitable, Dest & dest) {
+        auto && awaiter = get_awaiter(std::forward<Awaitable>(awaitable));
+        dest = co_await awaiter;
+    }
+
+
+    /*
+    * Awaiting it starts all the children in index order, each running until
+    * its first suspension, and resumes the awaiting coroutine when all of them
+    * are done, rethrowing the exception of the first one (by index) that failed.
+    * The children are destroyed with it.
+    */
+    template<std::size_t N>
+    class [[nodiscard]] when_all_awaitable
+    {
+    public:
+
+        explicit when_all_awaitable(std::array<when_all_child, N> children) noexcept
+            : m_children(std::move(children)), m_state(N + 1) {}
+
+        bool await_ready() const noexcept {
+            return N == 0;
+        }
+
+        bool await_suspend(std::coroutine_handle<> continuation) {
+            m_state.m_continuation = continuation;
+            for (auto & child : m_children)
+                child.start(m_state);
+            return !m_state.release();
+        }
+
+        void await_resume() const {
+            for (auto & child : m_children)
+                child.rethrow_if_failed();
+        }
+
+    private:
+
+        std::array<when_all_child, N> m_children;
+        when_all_state m_state;
+    };
+
+
+    template<typename Indices>
+    struct async_impl;
+
+    template<std::size_t ... I>
+    struct async_impl<std::index_sequence<I ...>>
+    {
+        template<typename Range, typename Func>
+        static auto for_each(Range && r, Func & f) {
+            return when_all_awaitable<sizeof...(I)>(std::array<when_all_child, sizeof...(I)>{
+                make_when_all_child(f(static_ranges::element<I>(std::forward<Range>(r)))) ...
+            });
+        }
+
+        template<typename Range1, typename Range2, typename Func>
+        static auto transform(Range1 && r1, Range2 && r2, Func & f) {
+            return when_all_awaitable<sizeof...(I)>(std::array<when_all_child, sizeof...(I)>{
+                make_when_all_child(f(static_ranges::element<I>(std::forward<Range1>(r1))),
+                                    static_ranges::element<I>(r2)) ...
+            });
+        }
+    };
+
+
+    /*
+    * Given a static range r and a functor f returning an awaitable for each
+    * element, returns an awaitable that starts all the awaitables f(eI)
+    * concurrently when awaited, and completes when every one of them has
+    * completed. Their results are discarded. f is called for every element
+    * before async_for_each returns; the range must outlive the awaiting.
+    *
+    * example:
+    *
+    * std::tuple<file, socket, file> sources = { ... };
+    * co_await static_ranges::async_for_each(sources, [&](auto & s) { return s.async_read(executor); });
+    */
+    template<typename Range, typename Func>
+        requires static_ranges::range<std::remove_cvref_t<Range>>
+    auto async_for_each(Range && r, Func && f) {
+        return async_impl<make_sequence<Range>>::for_each(std::forward<Range>(r), f);
+    }
+
+
+    /*
+    * Given two static ranges r1 and r2 of the same size and a functor f
+    * returning an awaitable for each element of r1, returns an awaitable that
+    * starts all the awaitables f(eI) concurrently when awaited, assigns the
+    * result of each to the element of r2 with the same index as it completes,
+    * and completes when every one of them has completed. r2 must outlive the
+    * awaiting.
+    *
+    * example:
+    *
+    * std::tuple<int, std::string, double> results;
+    * co_await static_ranges::async_transform(requests, results, [&](auto & req) { return fetch(executor, req); });
+    */
+    template<typename Range1, typename Range2, typename Func>
+        requires static_ranges::range<std::remove_cvref_t<Range1>> &&
+                 static_ranges::range<std::remove_cvref_t<Range2>> &&
+                 (range_nocvref<Range1>::value == range_nocvref<Range2>::value)
+    auto async_transform(Range1 && r1, Range2 && r2, Func && f) {
+        return async_impl<make_sequence<Range1>>::transform(std::forward<Range1>(r1), r2, f);
+    }
+
+
+    namespace execution {
+
+        /*
+        * A minimal event loop running coroutines on the calling thread: a FIFO
+        * queue of coroutines ready to resume and a queue of timers. Coroutines
+        * move onto it by awaiting schedule() or sleep_for(); run() resumes
+        * them until there is nothing left to wait for.
+        *
+        * example:
+        *
+        * static_ranges::execution::single_thread_executor executor;
+        * int x = executor.run(twice(21));
+        */
+        class single_thread_executor
+        {
+        public:
+
+            using clock = std::chrono::steady_clock;
+
+            single_thread_executor() = default;
+            single_thread_executor(const single_thread_executor &) = delete;
+            single_thread_executor & operator = (const single_thread_executor &) = delete;
+
+            /*
+            * Suspends the awaiting coroutine and queues it to be resumed.
+            */
+            [[nodiscard]] auto schedule() noexcept {
+                struct awaiter
+                {
+                    bool await_ready() const noexcept { return false; }
+
+                    void await_suspend(std::coroutine_handle<> h) {
+                        m_executor->m_ready.push_back(h);
+                    }
+
+                    void await_resume() const noexcept {}
+
+                    single_thread_executor * m_executor;
+                };
+                return awaiter{ this };
+            }
+
+            /*
+            * Suspends the awaiting coroutine until time, without blocking the
+            * others. Coroutines due at the same time resume in the order they
+            * started waiting.
+            */
+            [[nodiscard]] auto sleep_until(clock::time_point time) noexcept {
+                struct awaiter
+                {
+                    bool await_ready() const noexcept { return false; }
+
+                    void await_suspend(std::coroutine_handle<> h) {
+                        m_executor->m_timers.push({ m_time, m_executor->m_timer_count++, h });
+                    }
+
+                    void await_resume() const noexcept {}
+
+                    single_thread_executor * m_executor;
+                    clock::time_point m_time;
+                };
+                return awaiter{ this, time };
+            }
+
+            [[nodiscard]] auto sleep_for(clock::duration duration) noexcept {
+                return sleep_until(clock::now() + duration);
+            }
+
+            /*
+            * Resumes the queued coroutines until none is ready and no timer is
+            * pending, sleeping until the next timer when only timers are left.
+            */
+            void run() {
+                while (step()) {}
+            }
+
+            /*
+            * Awaits awaitable on the executor and returns its result: runs the
+            * loop until it has completed, rethrowing its exception if it failed.
+            * The awaitable is awaited in place, so it may be immovable, e.g. the
+            * result of async_for_each.
+            * Throws std::logic_error if the loop runs out of work first, i.e.
+            * the awaitable waits for something else than this executor.
+            */
+            template<typename Awaitable>
+            auto run(Awaitable && awaitable) {
+                using result_type = await_result_t<Awaitable>;
+
+                when_all_state state(1);
+                if constexpr (std::is_void_v<result_type>) {
+                    when_all_child child = make_when_all_child<Awaitable &&>(std::forward<Awaitable>(awaitable));
+                    wait(child, state);
+                }
+                else {
+                    std::optional<std::remove_cvref_t<result_type>> result;
+                    when_all_child child = make_when_all_child<Awaitable &&>(std::forward<Awaitable>(awaitable), result);
+                    wait(child, state);
+                    return std::move(*result);
+                }
+            }
+
+        private:
+
+            struct timer
+            {
+                clock::time_point m_time;
+                std::uint64_t m_order;
+                std::coroutine_handle<> m_handle;
+
+                bool operator > (const timer & other) const noexcept {
+                    return m_time != other.m_time ? m_time > other.m_time : m_order > other.m_order;
+                }
+            };
+
+            /*
+            * Resumes one ready coroutine, or else waits for the next timer and
+            * queues the coroutines that are due; returns false if there was
+            * nothing to do.
+            */
+            bool step() {
+                if (!m_ready.empty()) {
+                    std::coroutine_handle<> h = m_ready.front();
+                    m_ready.pop_front();
+                    h.resume();
+                    return true;
+                }
+                if (m_timers.empty())
+                    return false;
+                std::this_thread::sleep_until(m_timers.top().m_time);
+                const auto now = clock::now();
+                while (!m_timers.empty() && m_timers.top().m_time <= now) {
+                    m_ready.push_back(m_timers.top().m_handle);
+                    m_timers.pop();
+                }
+                return true;
+            }
+
+            void wait(when_all_child & child, when_all_state & state) {
+                child.start(state);
+                while (!child.done() && step()) {}
+                if (!child.done())
+                    throw std::logic_error("single_thread_executor::run: awaitable never completed");
+                child.rethrow_if_failed();
+            }
+
+            std::deque<std::coroutine_handle<>> m_ready;
+            std::priority_queue<timer, std::vector<timer>, std::greater<>> m_timers;
+            std::uint64_t m_timer_count = 0;
+        };
+
+    } // execution namespace
+
+} // static_ranges namespace
+
+#endif // __ASYNC_HPP__
@@ -0,0 +1,233 @@
+#ifndef __COMPARE_HPP__
+#define __COMPARE_HPP__
+
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "range_traits.hpp"
+#include "convenience.hpp"
+#include "concepts.hpp"
+
+namespace static_ranges {
+
+    /*
+    * Two contiguous ranges of the same element type whose equal elements
+    * have equal bytes, so they can be compared for equality with memcmp.
+    */
+    template<typename Range1, typename Range2>
+    concept memcmp_comparable =
+        contiguous_range<std::remove_cvref_t<Range1>> &&
+        contiguous_range<std::remove_cvref_t<Range2>> &&
+        std::is_same_v<contiguous_value_t<Range1>, contiguous_value_t<Range2>> &&
+        std::has_unique_object_representations_v<contiguous_value_t<Range1>>;
+
+    /*
+    * memcmp_comparable ranges of unsigned bytes, whose order is the order
+    * of memcmp as well.
+    */
+    template<typename Range1, typename Range2>
+    concept memcmp_orderable = memcmp_comparable<Range1, Range2> &&
+        sizeof(contiguous_value_t<Range1>) == 1 &&
+        (std::is_same_v<contiguous_value_t<Range1>, std::byte> ||
+         std::is_unsigned_v<contiguous_value_t<Range1>>);
+
+
+    template<typename Range1, typename Range2>
+        requires range<std::remove_cvref_t<Range1>> && range<std::remove_cvref_t<Range2>>
+    constexpr bool equal(Range1 && r1, Range2 && r2);
+
+    template<typename Range1, typename Range2>
+        requires range<std::remove_cvref_t<Range1>> && range<std::remove_cvref_t<Range2>>
+    constexpr auto compare_three_way(Range1 && r1, Range2 && r2);
+
+    template<typename Range1, typename Range2>
+        requires range<std::remove_cvref_t<Range1>> && range<std::remove_cvref_t<Range2>>
+    constexpr bool lexicographical_compare(Range1 && r1, Range2 && r2);
+
+
+    /*
+    * Comparison of two elements: nested static ranges are compared with the
+    * static range algorithms, other elements with their operators.
+    */
+    struct element_compare
+    {
+        template<typename E1, typename E2>
+        static constexpr bool both_ranges =
+            range<std::remove_cvref_t<E1>> && range<std::remove_cvref_t<E2>>;
+
+        template<typename E1, typename E2>
+        static constexpr bool equal(E1 && e1, E2 && e2) {
+            if constexpr (both_ranges<E1, E2>)
+                return static_ranges::equal(e1, e2);
+            else
+                return e1 == e2;
+        }
+
+        template<typename E1, typename E2>
+        static constexpr auto three_way(E1 && e1, E2 && e2) {
+            if constexpr (both_ranges<E1, E2>)
+                return static_ranges::compare_three_way(e1, e2);
+            else
+                return std::compare_three_way{}(e1, e2);
+        }
+
+        template<typename E1, typename E2>
+        static constexpr bool less(E1 && e1, E2 && e2) {
+            if constexpr (both_ranges<E1, E2>)
+                return static_ranges::lexicographical_compare(e1, e2);
+            else
+                return e1 < e2;
+        }
+    };
+
+
+    template<typename Indices>
+    struct compare_impl;
+
+    template<std::size_t ... I>
+    struct compare_impl<std::index_sequence<I ...>>
+    {
+        /*
+        * The && and || folds stop at the first element that decides the result.
+        */
+        template<typename Range1, typename Range2>
+        static constexpr bool equal(Range1 & r1, Range2 & r2) {
+            return (element_compare::equal(
+                static_ranges::element<I>(r1), static_ranges::element<I>(r2)) && ...);
+        }
+
+        template<typename Range1, typename Range2>
+        static constexpr auto three_way(Range1 & r1, Range2 & r2) {
+            using result = std::common_comparison_category_t<std::strong_ordering,
+                decltype(element_compare::three_way(static_ranges::element<I>(r1), static_ranges::element<I>(r2))) ...>;
+
+            result c = std::strong_ordering::equal;
+            (void)(((c = element_compare::three_way(
+                static_ranges::element<I>(r1), static_ranges::element<I>(r2))) != 0) || ...);
+            return c;
+        }
+
+        /*
+        * Returns -1 if r1 < r2, 1 if r2 < r1 and 0 if no element decides.
+        */
+        template<typename Range1, typename Range2>
+        static constexpr int less(Range1 & r1, Range2 & r2) {
+            int c = 0;
+            (void)(((c =
+                element_compare::less(static_ranges::element<I>(r1), static_ranges::element<I>(r2)) ? -1 :
+                element_compare::less(static_ranges::element<I>(r2), static_ranges::element<I>(r1)) ? 1 : 0) != 0) || ...);
+            return c;
+        }
+    };
+
+
+    /*
+    * memcmp over the first n elements of two memcmp_comparable ranges, with
+    * an element-wise loop in constant evaluation.
+    */
+    template<typename Range1, typename Range2>
+    constexpr int contiguous_compare(Range1 & r1, Range2 & r2, std::size_t n) {
+        const auto * d1 = std::addressof(static_ranges::element<0>(r1));
+        const auto * d2 = std::addressof(static_ranges::element<0>(r2));
+
+        if (std::is_constant_evaluated()) {
+            for (std::size_t i = 0; i < n; ++i)
+                if (d1[i] != d2[i])
+                    return d1[i] < d2[i] ? -1 : 1;
+            return 0;
+        }
+        return std::memcmp(d1, d2, n * sizeof(*d1));
+    }
+
+
+    /*
+    * Given two static ranges r1 and r2, return true if they have the same
+    * size and every element of r1 compares equal to the corresponding
+    * element of r2. Elements are compared in place, in index order, and the
+    * comparison stops at the first difference; nested static ranges are
+    * compared with static_ranges::equal.
+    * Contiguous ranges of the same element type with unique object
+    * representations (e.g. two std::array<int, N>) are compared with memcmp.
+    *
+    * example:
+    *
+    * std::tuple<int, std::string> r1 = { 42, "Foo" };
+    * std::pair<long, const char *> r2 = { 42, "Foo" };
+    * bool same = static_ranges::equal(r1, r2); // true
+    */
+    template<typename Range1, typename Range2>
+        requires range<std::remove_cvref_t<Range1>> && range<std::remove_cvref_t<Range2>>
+    constexpr bool equal(Range1 && r1, Range2 && r2) {
+        constexpr std::size_t size = range_nocvref<Range1>::value;
+
+        if constexpr (size != range_nocvref<Range2>::value)
+            return false;
+        else if constexpr (size != 0 && memcmp_comparable<Range1, Range2>)
+            return contiguous_compare(r1, r2, size) == 0;
+        else
+            return compare_impl<make_sequence<Range1>>::equal(r1, r2);
+    }
+
+
+    /*
+    * Given two static ranges r1 and r2, compare them lexicographically with
+    * operator <=> and return the result, of the common comparison category of
+    * the element comparisons: the result for the first pair of elements that
+    * don't compare equal or, if there is none, the result of comparing the sizes.
+    * Nested static ranges are compared with static_ranges::compare_three_way.
+    * Contiguous ranges of unsigned bytes are compared with memcmp.
+    *
+    * example:
+    *
+    * std::tuple<int, std::string> r1 = { 42, "Bar" };
+    * std::tuple<int, std::string> r2 = { 42, "Foo" };
+    * static_ranges::compare_three_way(r1, r2) < 0; // true
+    */
+    template<typename Range1, typename Range2>
+        requires range<std::remove_cvref_t<Range1>> && range<std::remove_cvref_t<Range2>>
+    constexpr auto compare_three_way(Range1 && r1, Range2 && r2) {
+        constexpr std::size_t size1 = range_nocvref<Range1>::value;
+        constexpr std::size_t size2 = range_nocvref<Range2>::value;
+        constexpr std::size_t size = std::min(size1, size2);
+
+        if constexpr (size != 0 && memcmp_orderable<Range1, Range2>) {
+            int c = contiguous_compare(r1, r2, size);
+            return c != 0 ? c <=> 0 : size1 <=> size2;
+        }
+        else {
+            auto c = compare_impl<std::make_index_sequence<size>>::three_way(r1, r2);
+            return c != 0 ? c : decltype(c)(size1 <=> size2);
+        }
+    }
+
+
+    /*
+    * Given two static ranges r1 and r2, return true if r1 is lexicographically
+    * less than r2, using only operator < of the elements. The comparison stops
+    * at the first pair of elements of which one is less than the other.
+    */
+    template<typename Range1, typename Range2>
+        requires range<std::remove_cvref_t<Range1>> && range<std::remove_cvref_t<Range2>>
+    constexpr bool lexicographical_compare(Range1 && r1, Range2 && r2) {
+        constexpr std::size_t size1 = range_nocvref<Range1>::value;
+        constexpr std::size_t size2 = range_nocvref<Range2>::value;
+        constexpr std::size_t size = std::min(size1, size2);
+
+        int c = 0;
+        if constexpr (size != 0 && memcmp_orderable<Range1, Range2>)
+            c = contiguous_compare(r1, r2, size);
+        else
+            c = compare_impl<std::make_index_sequence<size>>::less(r1, r2);
+
+        return c != 0 ? c < 0 : size1 < size2;
+    }
+
+} // static_ranges namespace
+
+#endif // __COMPARE_HPP__
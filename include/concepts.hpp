@@ -2,6 +2,7 @@
 #define __CONCEPTS_HPP__
 
 #include <type_traits>
+#include <utility>
 
 #include "range_traits.hpp"
 
@@ -101,6 +102,20 @@ namespace static_ranges {
         range<View> &&
         is_view_base_child<View>;
 
+    /*
+    * The contiguous_range<T> concept is satisfied if:
+    * 1) T is a non-empty range
+    * 2) static_ranges::enable_contiguous_range<std::remove_cvref_t<T>> is true
+    * 3) get<0> returns an lvalue reference
+    */
+    template<typename T>
+    concept contiguous_range =
+        range<T> &&
+        range_traits<std::remove_cvref_t<T>>::value != 0 &&
+        enable_contiguous_range<std::remove_cvref_t<T>> &&
+        std::is_lvalue_reference_v<decltype(
+            range_traits<std::remove_cvref_t<T>>::template get<0>(std::declval<T &>()))>;
+
     template<typename Range>
     concept range_but_not_view =
         range<Range> && !is_view_base_child<Range>;
@@ -37,6 +37,14 @@ namespace static_ranges
         return range_nocvref<Range>::template get<I>(std::forward<Range>(t));
     }
 
+
+    /*
+    * The element type of a contiguous range, without references and cv-qualifiers.
+    */
+    template<typename Range>
+    using contiguous_value_t = std::remove_cvref_t<
+        decltype(static_ranges::element<0>(std::declval<Range &>()))>;
+
 } // static_ranges namespace
 
 #endif // __CONVENIENCE_HPP__
\ No newline at end of file
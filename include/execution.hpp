@@ -0,0 +1,481 @@
+#ifndef __EXECUTION_HPP__
+#define __EXECUTION_HPP__
+
+/*
+* Execution policies of for_each and transform: seq, and par with its thread
+* pool. Not included by static_ranges.hpp, since <thread> and friends are
+* costly to parse and par needs the program to link Threads::Threads.
+*/
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "range_traits.hpp"
+#include "convenience.hpp"
+#include "concepts.hpp"
+#include "helpers.hpp"
+
+namespace static_ranges {
+
+    namespace execution {
+
+        /*
+        * A bounded pool of worker threads executing the tasks submitted to it
+        * in FIFO order. The threads are joined when the pool is destroyed.
+        */
+        class thread_pool
+        {
+        public:
+
+            explicit thread_pool(std::size_t threads)
+            {
+                m_threads.reserve(threads);
+                for (std::size_t i = 0; i < threads; ++i)
+                    m_threads.emplace_back([this] { run(); });
+            }
+
+            thread_pool(const thread_pool &) = delete;
+            thread_pool & operator = (const thread_pool &) = delete;
+
+            ~thread_pool()
+            {
+                {
+                    std::lock_guard lock(m_mutex);
+                    m_stop = true;
+                }
+                m_cv.notify_all();
+                for (auto & t : m_threads)
+                    t.join();
+            }
+
+            std::size_t size() const noexcept {
+                return m_threads.size();
+            }
+
+            void submit(std::function<void()> task)
+            {
+                {
+                    std::lock_guard lock(m_mutex);
+                    m_tasks.push_back(std::move(task));
+                }
+                m_cv.notify_one();
+            }
+
+            /*
+            * The pool used by the parallel algorithms unless a policy names
+            * another one. It has one thread less than the hardware supports
+            * (but at least one), since the calling thread takes part in the
+            * work too.
+            */
+            static thread_pool & instance()
+            {
+                static thread_pool pool(std::max(2u, std::thread::hardware_concurrency()) - 1);
+                return pool;
+            }
+
+        private:
+
+            void run()
+            {
+                for (;;) {
+                    std::function<void()> task;
+                    {
+                        std::unique_lock lock(m_mutex);
+                        m_cv.wait(lock, [this] { return m_stop || !m_tasks.empty(); });
+                        if (m_tasks.empty())
+                            return;
+                        task = std::move(m_tasks.front());
+                        m_tasks.pop_front();
+                    }
+                    task();
+                }
+            }
+
+            std::mutex m_mutex;
+            std::condition_variable m_cv;
+            std::deque<std::function<void()>> m_tasks;
+            std::vector<std::thread> m_threads;
+            bool m_stop = false;
+        };
+
+
+        /*
+        * Execution policy of the sequential algorithms, i.e.
+        * for_each(seq, r, f) is equivalent to for_each(r, f).
+        */
+        struct sequenced_policy
+        {};
+
+
+        /*
+        * Execution policy that runs the call for every element of a static
+        * range as a separate task on a thread pool and joins before returning.
+        *
+        * example:
+        *
+        * static_ranges::for_each(static_ranges::execution::par, shards, [](auto & s) { s.run(); });
+        * static_ranges::for_each(
+        *     static_ranges::execution::par.with_work_stealing().with_max_concurrency(4),
+        *     shards, [](auto & s) { s.run(); });
+        */
+        struct parallel_policy
+        {
+        public:
+
+            /*
+            * Run on the given pool instead of thread_pool::instance().
+            */
+            constexpr parallel_policy with_pool(thread_pool & pool) const {
+                auto p = *this;
+                p.m_pool = &pool;
+                return p;
+            }
+
+            /*
+            * Use at most n threads, including the calling one (0: no limit).
+            */
+            constexpr parallel_policy with_max_concurrency(std::size_t n) const {
+                auto p = *this;
+                p.m_max_concurrency = n;
+                return p;
+            }
+
+            /*
+            * Ranges with less than n elements are processed sequentially
+            * by the calling thread.
+            */
+            constexpr parallel_policy with_sequential_threshold(std::size_t n) const {
+                auto p = *this;
+                p.m_sequential_threshold = n;
+                return p;
+            }
+
+            /*
+            * Split the elements evenly between the threads up front; a thread
+            * that runs out of work steals from the back of the others' shares.
+            * By default, threads take the next element from a shared counter.
+            */
+            constexpr parallel_policy with_work_stealing(bool enabled = true) const {
+                auto p = *this;
+                p.m_work_stealing = enabled;
+                return p;
+            }
+
+            thread_pool * m_pool = nullptr;
+            std::size_t m_max_concurrency = 0;
+
+            /*
+            * In the light-element table of bench/parallel_bench.cpp, the pool
+            * round trip is worst relative to the work at 2 and 4 elements and
+            * gets amortized from 8 on; smaller ranges of heavy elements opt in
+            * with with_sequential_threshold(2).
+            */
+            std::size_t m_sequential_threshold = 8;
+            bool m_work_stealing = false;
+        };
+
+
+        inline constexpr sequenced_policy seq{};
+        inline constexpr parallel_policy par{};
+
+
+        /*
+        * Shared state of one parallel algorithm call. Owned jointly by the
+        * calling thread and the tasks submitted to the pool, so a task that
+        * starts after the call returned finds the job closed and exits without
+        * touching the range or the functor.
+        */
+        class parallel_job
+        {
+        public:
+
+            parallel_job(std::size_t size, std::size_t participants, bool work_stealing)
+                : m_size(size),
+                  m_shares(work_stealing ? participants : 0)
+            {
+                for (std::size_t slot = 0; slot < m_shares.size(); ++slot) {
+                    std::uint64_t begin = size * slot / participants;
+                    std::uint64_t end = size * (slot + 1) / participants;
+                    m_shares[slot].store(begin | (end << 32), std::memory_order_relaxed);
+                }
+            }
+
+            /*
+            * Registers a pool task as a participant. Returns false if the
+            * job is already closed.
+            */
+            bool enter(std::size_t & slot)
+            {
+                std::lock_guard lock(m_mutex);
+                if (m_closed)
+                    return false;
+                ++m_active;
+                slot = ++m_next_slot;
+                return true;
+            }
+
+            void leave()
+            {
+                {
+                    std::lock_guard lock(m_mutex);
+                    --m_active;
+                }
+                m_cv.notify_all();
+            }
+
+            /*
+            * Called by the calling thread once it ran out of work: no task may
+            * enter afterwards, wait for the ones still running.
+            */
+            void close_and_wait()
+            {
+                std::unique_lock lock(m_mutex);
+                m_closed = true;
+                m_cv.wait(lock, [this] { return m_active == 0; });
+                if (m_error)
+                    std::rethrow_exception(m_error);
+            }
+
+            /*
+            * Runs table[i](ctx) for every index claimed by the participant.
+            */
+            void work(std::size_t slot, void (* const * table)(void *), void * ctx)
+            {
+                for (std::size_t i; (i = claim(slot)) < m_size;) {
+                    try {
+                        table[i](ctx);
+                    }
+                    catch (...) {
+                        std::lock_guard lock(m_mutex);
+                        if (!m_error)
+                            m_error = std::current_exception();
+                        m_failed.store(true, std::memory_order_relaxed);
+                    }
+                }
+            }
+
+        private:
+
+            /*
+            * Returns the next index to process, or m_size if there is none left.
+            */
+            std::size_t claim(std::size_t slot)
+            {
+                if (m_failed.load(std::memory_order_relaxed))
+                    return m_size;
+
+                if (m_shares.empty()) {
+                    std::size_t i = m_next.fetch_add(1, std::memory_order_relaxed);
+                    return std::min(i, m_size);
+                }
+
+                // own share from the front, then the others' from the back
+                for (std::size_t k = 0; k < m_shares.size(); ++k) {
+                    auto & share = m_shares[(slot + k) % m_shares.size()];
+                    std::uint64_t cur = share.load(std::memory_order_relaxed);
+                    for (;;) {
+                        std::uint64_t begin = cur & 0xffffffffu;
+                        std::uint64_t end = cur >> 32;
+                        if (begin >= end)
+                            break;
+
+                        std::uint64_t next = k == 0 ? (begin + 1) | (end << 32) : begin | ((end - 1) << 32);
+                        if (share.compare_exchange_weak(cur, next, std::memory_order_relaxed))
+                            return k == 0 ? begin : end - 1;
+                    }
+                }
+                return m_size;
+            }
+
+            const std::size_t m_size;
+            std::atomic<std::size_t> m_next = 0;
+            std::vector<std::atomic<std::uint64_t>> m_shares;
+            std::atomic<bool> m_failed = false;
+
+            std::mutex m_mutex;
+            std::condition_variable m_cv;
+            std::size_t m_active = 0;
+            std::size_t m_next_slot = 0;
+            bool m_closed = false;
+            std::exception_ptr m_error;
+        };
+
+
+        /*
+        * Runs table[i](ctx) for every i in [0, n) according to the policy and
+        * returns once all of them finished. The first exception thrown by a
+        * call is rethrown; the elements not started yet are skipped then.
+        */
+        inline void run_indexed(const parallel_policy & policy, std::size_t n,
+                                void (* const * table)(void *), void * ctx)
+        {
+            thread_pool & pool = policy.m_pool ? *policy.m_pool : thread_pool::instance();
+
+            std::size_t participants = std::min(n, pool.size() + 1);
+            if (policy.m_max_concurrency)
+                participants = std::min(participants, policy.m_max_concurrency);
+
+            if (n < policy.m_sequential_threshold || participants < 2) {
+                for (std::size_t i = 0; i < n; ++i)
+                    table[i](ctx);
+                return;
+            }
+
+            auto job = std::make_shared<parallel_job>(n, participants, policy.m_work_stealing);
+
+            for (std::size_t t = 1; t < participants; ++t) {
+                pool.submit([job, table, ctx] {
+                    std::size_t slot;
+                    if (!job->enter(slot))
+                        return;
+                    job->work(slot, table, ctx);
+                    job->leave();
+                });
+            }
+
+            job->work(0, table, ctx);
+            job->close_and_wait();
+        }
+
+
+        template<typename Indices>
+        struct parallel_impl;
+
+        template<std::size_t ... I>
+        struct parallel_impl<std::index_sequence<I ...>>
+        {
+            template<std::size_t J, typename Op>
+            static void call(void * op) {
+                (*static_cast<Op *>(op))(std::integral_constant<std::size_t, J>());
+            }
+
+            /*
+            * Calls op(std::integral_constant<std::size_t, I>()) for every I,
+            * each call being a separate task.
+            */
+            template<typename Op>
+            static void run(const parallel_policy & policy, Op & op) {
+                static constexpr std::array<void (*)(void *), sizeof...(I)> table = { &call<I, Op> ... };
+                run_indexed(policy, table.size(), table.data(), &op);
+            }
+        };
+
+    } // execution namespace
+
+
+    /*
+    * for_each(seq, r, f) is equivalent to for_each(r, f).
+    */
+    template<typename Range, typename Func>
+        requires range<std::remove_cvref_t<Range>>
+    constexpr void for_each(const execution::sequenced_policy &, Range && r, Func && f) {
+        static_ranges::for_each(std::forward<Range>(r), std::forward<Func>(f));
+    }
+
+
+    /*
+    * Given a static range r and a functor f, apply f(e) to every element e
+    * of r. Every call runs as a separate task on the thread pool of the policy;
+    * the function returns once all of them finished.
+    * f may be called concurrently from several threads.
+    *
+    * example:
+    *
+    * std::tuple<shard<0>, shard<1>, shard<2>> shards;
+    * static_ranges::for_each(static_ranges::execution::par, shards, [](auto & s) { s.run(); });
+    */
+    template<typename Range, typename Func>
+        requires range<std::remove_cvref_t<Range>>
+    void for_each(const execution::parallel_policy & policy, Range && r, Func && f) {
+        auto op = [&]<std::size_t I>(std::integral_constant<std::size_t, I>) {
+            f(static_ranges::element<I>(std::forward<Range>(r)));
+        };
+        execution::parallel_impl<make_sequence<Range>>::run(policy, op);
+    }
+
+
+    /*
+    * transform(seq, r1, r2, f) is equivalent to transform(r1, r2, f).
+    */
+    template<typename RangeSrc, typename RangeDest, typename Func>
+        requires (range_nocvref<RangeSrc>::value == range_nocvref<RangeDest>::value)
+    constexpr void transform(const execution::sequenced_policy &, RangeSrc && r1, RangeDest & r2, Func && f) {
+        static_ranges::transform(std::forward<RangeSrc>(r1), r2, std::forward<Func>(f));
+    }
+
+
+    /*
+    * transform(seq, r1, r2, r3, f) is equivalent to transform(r1, r2, r3, f).
+    */
+    template<typename RangeSrc1, typename RangeSrc2, typename RangeDest, typename Func>
+        requires (range_nocvref<RangeSrc1>::value == range_nocvref<RangeDest>::value &&
+                  range_nocvref<RangeSrc1>::value == range_nocvref<RangeSrc2>::value)
+    constexpr void transform(const execution::sequenced_policy &,
+                             RangeSrc1 && r1, RangeSrc2 && r2, RangeDest & r3, Func && f) {
+        static_ranges::transform(
+            std::forward<RangeSrc1>(r1),
+            std::forward<RangeSrc2>(r2),
+            r3,
+            std::forward<Func>(f));
+    }
+
+
+    /*
+    * Parallel version of transform(r1, r2, f): the I-th element of r2 is
+    * assigned f(e1I) by a separate task on the thread pool of the policy.
+    */
+    template<typename RangeSrc, typename RangeDest, typename Func>
+        requires (range_nocvref<RangeSrc>::value == range_nocvref<RangeDest>::value)
+    void transform(const execution::parallel_policy & policy, RangeSrc && r1, RangeDest & r2, Func && f) {
+        auto op = [&]<std::size_t I>(std::integral_constant<std::size_t, I>) {
+            static_assert(std::is_assignable_v<
+                decltype(static_ranges::element<I>(r2)),
+                decltype(f(static_ranges::element<I>(std::forward<RangeSrc>(r1))))>,
+                TRANSFORM_ONE_ERROR);
+
+            static_ranges::element<I>(r2) = f(
+                static_ranges::element<I>(std::forward<RangeSrc>(r1)));
+        };
+        execution::parallel_impl<make_sequence<RangeSrc>>::run(policy, op);
+    }
+
+
+    /*
+    * Parallel version of transform(r1, r2, r3, f): the I-th element of r3 is
+    * assigned f(e1I, e2I) by a separate task on the thread pool of the policy.
+    */
+    template<typename RangeSrc1, typename RangeSrc2, typename RangeDest, typename Func>
+        requires (range_nocvref<RangeSrc1>::value == range_nocvref<RangeDest>::value &&
+                  range_nocvref<RangeSrc1>::value == range_nocvref<RangeSrc2>::value)
+    void transform(const execution::parallel_policy & policy,
+                   RangeSrc1 && r1, RangeSrc2 && r2, RangeDest & r3, Func && f) {
+        auto op = [&]<std::size_t I>(std::integral_constant<std::size_t, I>) {
+            static_assert(std::is_assignable_v<
+                decltype(static_ranges::element<I>(r3)),
+                decltype(f(
+                    static_ranges::element<I>(std::forward<RangeSrc1>(r1)),
+                    static_ranges::element<I>(std::forward<RangeSrc2>(r2))))>,
+                TRANSFORM_TWO_ERROR);
+
+            static_ranges::element<I>(r3) = f(
+                static_ranges::element<I>(std::forward<RangeSrc1>(r1)),
+                static_ranges::element<I>(std::forward<RangeSrc2>(r2)));
+        };
+        execution::parallel_impl<make_sequence<RangeSrc1>>::run(policy, op);
+    }
+
+} // static_ranges namespace
+
+#endif // __EXECUTION_HPP__
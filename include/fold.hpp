@@ -0,0 +1,196 @@
+#ifndef __FOLD_HPP__
+#define __FOLD_HPP__
+
+#include <type_traits>
+#include <utility>
+
+#include "range_traits.hpp"
+#include "convenience.hpp"
+#include "concepts.hpp"
+
+namespace static_ranges {
+
+    /*
+    * Folds the elements Begin <= I < End of a static range into an
+    * accumulator. The index range is split in halves, the accumulator of
+    * one half being the initial value of the other, so the type of the
+    * accumulated value can change with every element while the recursion
+    * is only log2(N) levels deep.
+    */
+    template<std::size_t Begin, std::size_t End>
+    struct fold_impl
+    {
+        template<typename Range, typename T, typename Func>
+        static constexpr auto left(Range && r, T && acc, Func & f) {
+            if constexpr (End - Begin == 0) {
+                return std::decay_t<T>(std::forward<T>(acc));
+            }
+            else if constexpr (End - Begin == 1) {
+                return f(std::forward<T>(acc), static_ranges::element<Begin>(std::forward<Range>(r)));
+            }
+            else {
+                constexpr std::size_t Mid = Begin + (End - Begin) / 2;
+                return fold_impl<Mid, End>::left(std::forward<Range>(r),
+                    fold_impl<Begin, Mid>::left(std::forward<Range>(r), std::forward<T>(acc), f), f);
+            }
+        }
+
+        template<typename Range, typename T, typename Func>
+        static constexpr auto right(Range && r, T && acc, Func & f) {
+            if constexpr (End - Begin == 0) {
+                return std::decay_t<T>(std::forward<T>(acc));
+            }
+            else if constexpr (End - Begin == 1) {
+                return f(static_ranges::element<Begin>(std::forward<Range>(r)), std::forward<T>(acc));
+            }
+            else {
+                constexpr std::size_t Mid = Begin + (End - Begin) / 2;
+                return fold_impl<Begin, Mid>::right(std::forward<Range>(r),
+                    fold_impl<Mid, End>::right(std::forward<Range>(r), std::forward<T>(acc), f), f);
+            }
+        }
+    };
+
+
+    /*
+    * Given a static range r, an initial value and a binary functor f, return
+    * f(...f(f(init, e0), e1)..., eN-1). The type of the accumulated value may
+    * differ from one step to the next.
+    *
+    * example:
+    *
+    * std::tuple<int, double, std::string> r = { 42, 3.14, "Foo" };
+    * auto s = static_ranges::fold_left(r, std::string(),
+    *     [](std::string acc, auto && v) { return acc + to_string(v); });
+    */
+    template<typename Range, typename T, typename Func>
+        requires range<std::remove_cvref_t<Range>>
+    constexpr auto fold_left(Range && r, T && init, Func && f) {
+        return fold_impl<0, range_nocvref<Range>::value>::left(
+            std::forward<Range>(r), std::decay_t<T>(std::forward<T>(init)), f);
+    }
+
+
+    /*
+    * Given a static range r, an initial value and a binary functor f, return
+    * f(e0, f(e1, ...f(eN-1, init)...)).
+    */
+    template<typename Range, typename T, typename Func>
+        requires range<std::remove_cvref_t<Range>>
+    constexpr auto fold_right(Range && r, T && init, Func && f) {
+        return fold_impl<0, range_nocvref<Range>::value>::right(
+            std::forward<Range>(r), std::decay_t<T>(std::forward<T>(init)), f);
+    }
+
+
+    /*
+    * Combines the leaves leaf(std::integral_constant<std::size_t, I>()),
+    * Begin <= I < End, pairwise in a balanced tree: the two halves are
+    * reduced independently and joined by f. The independent subtrees
+    * expose instruction-level parallelism a left-to-right chain does not.
+    */
+    template<std::size_t Begin, std::size_t End>
+    struct reduce_tree
+    {
+        template<typename Leaf, typename Func>
+        static constexpr decltype(auto) call(Leaf & leaf, Func & f) {
+            if constexpr (End - Begin == 1) {
+                return leaf(std::integral_constant<std::size_t, Begin>());
+            }
+            else {
+                constexpr std::size_t Mid = Begin + (End - Begin) / 2;
+                return f(
+                    reduce_tree<Begin, Mid>::call(leaf, f),
+                    reduce_tree<Mid, End>::call(leaf, f));
+            }
+        }
+    };
+
+
+    /*
+    * Given a non-empty static range r and a binary functor f, combine all
+    * the elements with f in a balanced tree, e.g. for 4 elements
+    * f(f(e0, e1), f(e2, e3)). f should be associative.
+    */
+    template<typename Range, typename Func>
+        requires (range<std::remove_cvref_t<Range>> && range_nocvref<Range>::value != 0)
+    constexpr auto reduce(Range && r, Func && f) {
+        auto leaf = [&r]<std::size_t I>(std::integral_constant<std::size_t, I>) -> decltype(auto) {
+            return static_ranges::element<I>(std::forward<Range>(r));
+        };
+        return reduce_tree<0, range_nocvref<Range>::value>::call(leaf, f);
+    }
+
+
+    /*
+    * Returns f(init, reduce(r, f)), or init if r is empty.
+    */
+    template<typename Range, typename T, typename Func>
+        requires range<std::remove_cvref_t<Range>>
+    constexpr auto reduce(Range && r, T && init, Func && f) {
+        if constexpr (range_nocvref<Range>::value == 0)
+            return std::decay_t<T>(std::forward<T>(init));
+        else
+            return f(std::forward<T>(init), static_ranges::reduce(std::forward<Range>(r), f));
+    }
+
+
+    /*
+    * Given a static range r, an initial value and the functors reduce_op and
+    * transform_op, return reduce_op(init, x) where x is the result of combining
+    * transform_op(eI) for all elements eI of r with reduce_op in a balanced tree.
+    * Returns init if r is empty.
+    *
+    * example:
+    *
+    * auto squares = static_ranges::transform_reduce(r, 0.0, std::plus<>(), [](auto v) { return v * v; });
+    */
+    template<typename Range, typename T, typename ReduceOp, typename TransformOp>
+        requires range<std::remove_cvref_t<Range>>
+    constexpr auto transform_reduce(Range && r, T && init, ReduceOp && reduce_op, TransformOp && transform_op) {
+        if constexpr (range_nocvref<Range>::value == 0) {
+            return std::decay_t<T>(std::forward<T>(init));
+        }
+        else {
+            auto leaf = [&r, &transform_op]<std::size_t I>(std::integral_constant<std::size_t, I>) -> decltype(auto) {
+                return transform_op(static_ranges::element<I>(std::forward<Range>(r)));
+            };
+            return reduce_op(
+                std::forward<T>(init),
+                reduce_tree<0, range_nocvref<Range>::value>::call(leaf, reduce_op));
+        }
+    }
+
+
+    /*
+    * Same as transform_reduce(r, init, reduce_op, transform_op), with the
+    * leaves transform_op(e1I, e2I) over the corresponding elements of two
+    * static ranges of the same size.
+    *
+    * example:
+    *
+    * auto dot = static_ranges::transform_reduce(r1, r2, 0.0, std::plus<>(), std::multiplies<>());
+    */
+    template<typename Range1, typename Range2, typename T, typename ReduceOp, typename TransformOp>
+        requires (range<std::remove_cvref_t<Range1>> && range<std::remove_cvref_t<Range2>> &&
+                  range_nocvref<Range1>::value == range_nocvref<Range2>::value)
+    constexpr auto transform_reduce(Range1 && r1, Range2 && r2, T && init,
+                                    ReduceOp && reduce_op, TransformOp && transform_op) {
+        if constexpr (range_nocvref<Range1>::value == 0) {
+            return std::decay_t<T>(std::forward<T>(init));
+        }
+        else {
+            auto leaf = [&r1, &r2, &transform_op]<std::size_t I>(std::integral_constant<std::size_t, I>) -> decltype(auto) {
+                return transform_op(
+                    static_ranges::element<I>(std::forward<Range1>(r1)),
+                    static_ranges::element<I>(std::forward<Range2>(r2)));
+            };
+            return reduce_op(
+                std::forward<T>(init),
+                reduce_tree<0, range_nocvref<Range1>::value>::call(leaf, reduce_op));
+        }
+    }
+
+} // static_ranges namespace
+
+#endif // __FOLD_HPP__
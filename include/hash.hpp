@@ -0,0 +1,147 @@
+#ifndef __HASH_HPP__
+#define __HASH_HPP__
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "range_traits.hpp"
+#include "convenience.hpp"
+#include "concepts.hpp"
+
+namespace static_ranges {
+
+    /*
+    * The combining scheme of static_ranges::hash: every element hash is
+    * folded into the state with one rotate, xor and multiply, and the
+    * state is mixed once at the end (the 64-bit MurmurHash3 finalizer),
+    * instead of the add/shift/xor chain of boost-style hash_combine.
+    */
+    struct hash_state
+    {
+        static constexpr std::uint64_t seed = 0x9e3779b97f4a7c15ull;
+
+        static constexpr std::uint64_t step(std::uint64_t h, std::uint64_t v) {
+            return (std::rotl(h, 5) ^ v) * 0x517cc1b727220a95ull;
+        }
+
+        static constexpr std::uint64_t finalize(std::uint64_t h) {
+            h ^= h >> 33;
+            h *= 0xff51afd7ed558ccdull;
+            h ^= h >> 33;
+            h *= 0xc4ceb9fe1a85ec53ull;
+            h ^= h >> 33;
+            return h;
+        }
+
+        /*
+        * The value folded for an integer element: the integer itself,
+        * widened, whatever path the range is hashed by.
+        */
+        template<typename T>
+            requires std::is_integral_v<T>
+        static constexpr std::uint64_t integer(T v) {
+            return static_cast<std::uint64_t>(v);
+        }
+    };
+
+
+    /*
+    * Contiguous ranges of integers, whose elements are folded into the
+    * state by one run-time loop over the span instead of one statement per
+    * element. The result is the one of the element-wise path: the span is
+    * not hashed as raw bytes, since folding several elements per step would
+    * give another hash than the tuple with the same values.
+    */
+    template<typename Range>
+    concept integer_span_hashable = contiguous_range<Range> &&
+        std::is_integral_v<contiguous_value_t<Range>>;
+
+
+    template<typename Range>
+        requires static_ranges::range<std::remove_cvref_t<Range>>
+    std::size_t hash(const Range & r);
+
+
+    template<typename Indices>
+    struct hash_impl;
+
+    template<std::size_t ... I>
+    struct hash_impl<std::index_sequence<I ...>>
+    {
+        template<typename E>
+        static std::uint64_t element_hash(const E & e) {
+            if constexpr (static_ranges::range<E>)
+                return static_ranges::hash(e);
+            else if constexpr (std::is_integral_v<E>)
+                return hash_state::integer(e);
+            else
+                return std::hash<E>{}(e);
+        }
+
+        template<typename Range>
+        static std::uint64_t call(const Range & r) {
+            std::uint64_t h = hash_state::seed;
+            (void)std::initializer_list<int>{ ((void)(h = hash_state::step(h, element_hash(
+                static_ranges::element<I>(r)))), 0)... };
+            return hash_state::finalize(h);
+        }
+    };
+
+
+    /*
+    * Returns a hash of the static range r, combined from the hashes of its
+    * elements: nested static ranges are hashed recursively, integers by
+    * their value, other elements with std::hash. Contiguous ranges of
+    * integers (e.g. std::array<int, N>) are hashed in a single pass over the
+    * span, with the same result as element by element. Static ranges of the
+    * same type comparing equal element-wise have equal hashes; ranges of
+    * different types need not, although std::array<int, 2> and
+    * std::tuple<int, int> do.
+    *
+    * example:
+    *
+    * std::tuple<int, std::string, std::array<short, 4>> key = { 42, "Foo", { 1, 2, 3, 4 } };
+    * std::size_t h = static_ranges::hash(key);
+    */
+    template<typename Range>
+        requires static_ranges::range<std::remove_cvref_t<Range>>
+    std::size_t hash(const Range & r) {
+        if constexpr (integer_span_hashable<std::remove_cvref_t<Range>>) {
+            const auto * data = std::addressof(static_ranges::element<0>(r));
+            std::uint64_t h = hash_state::seed;
+            for (std::size_t i = 0; i < range_nocvref<Range>::value; ++i)
+                h = hash_state::step(h, hash_state::integer(data[i]));
+            return static_cast<std::size_t>(hash_state::finalize(h));
+        }
+        else {
+            return static_cast<std::size_t>(hash_impl<make_sequence<Range>>::call(r));
+        }
+    }
+
+
+    /*
+    * Function object calling static_ranges::hash, to be used as the hash
+    * of containers keyed by static ranges.
+    *
+    * example:
+    *
+    * std::unordered_map<std::tuple<int, std::string>, double, static_ranges::hasher> map;
+    */
+    struct hasher
+    {
+        template<typename Range>
+            requires static_ranges::range<std::remove_cvref_t<Range>>
+        std::size_t operator()(const Range & r) const {
+            return static_ranges::hash(r);
+        }
+    };
+
+} // static_ranges namespace
+
+#endif // __HASH_HPP__
@@ -4,6 +4,9 @@
 #include <type_traits>
 #include <utility>
 #include <array>
+#include <initializer_list>
+#include <memory>
+#include <stdexcept>
 
 #include "range_traits.hpp"
 #include "concepts.hpp"
@@ -11,6 +14,7 @@
 
 #define TRANSFORM_ONE_ERROR "f(e1I) must be copy-assignable to the I-th element of r2"
 #define TRANSFORM_TWO_ERROR "f(e1I,e2I) must be copy-assignable to the I-th element of r3"
+#define VISIT_AT_RESULT_ERROR "f(eI) must have the same type for all elements eI of r"
 #define COPY_ASSIGN_ERROR "Each element i in range_src must be copy assignable to the corresponding range_src"
 
 namespace static_ranges {
@@ -18,31 +22,23 @@ namespace static_ranges {
     template<typename Indices>
     struct copy_impl;
 
-    template<std::size_t I, std::size_t ... Is>
-    struct copy_impl<std::index_sequence<I, Is ...>>
+    template<std::size_t ... I>
+    struct copy_impl<std::index_sequence<I ...>>
     {
         template<typename RangeSrc, typename RangeDest>
-        static void assign(RangeSrc && r1, RangeDest & r2) {
+        static constexpr void assign(RangeSrc && r1, RangeDest & r2) {
 
-            static_assert(std::is_assignable_v<
+            static_assert((std::is_assignable_v<
                 decltype(static_ranges::element<I>(r2)),
-                decltype(static_ranges::element<I>(r1))>,
+                decltype(static_ranges::element<I>(std::forward<RangeSrc>(r1)))> && ...),
                 COPY_ASSIGN_ERROR);
 
-            static_ranges::element<I>(r2) = static_ranges::element<I>(std::move(r1));
-
-            copy_impl<std::index_sequence<Is ...>>::assign(std::move(r1), r2);
+            (void)std::initializer_list<int>{ ((void)(
+                static_ranges::element<I>(r2) = static_ranges::element<I>(std::forward<RangeSrc>(r1))), 0)... };
         }
         
     };
 
-    template<>
-    struct copy_impl<std::index_sequence<>>
-    {
-        template<typename Range1, typename Range2>
-        static void assign(Range1 && r1, Range2 & r2) {}
-    };
-
 
     /*
     * Given two static ranges r1 and r2, copy all elements of r1 to r2.
@@ -68,8 +64,14 @@ namespace static_ranges {
     {
         template<typename Range, typename Func>
             requires range<std::remove_cvref_t<Range>>
-        static void call(Range && r, Func && f) {
-            (f(static_ranges::element<I>(std::forward<Range>(r))), ...);
+        static constexpr void call(Range && r, Func && f) {
+            /*
+            * The elements are visited through a braced-init-list rather than a
+            * comma fold expression: both are evaluated left to right, but GCC
+            * handles the fold in quadratic time for ranges of thousands of elements.
+            */
+            (void)std::initializer_list<int>{ ((void)f(
+                static_ranges::element<I>(std::forward<Range>(r))), 0)... };
         }
     };
 
@@ -97,56 +99,83 @@ namespace static_ranges {
     struct transform_impl;
 
 
-    template<std::size_t I, std::size_t ... Is>
-    struct transform_impl<std::index_sequence<I, Is ...>> {
+    template<std::size_t ... I>
+    struct transform_impl<std::index_sequence<I ...>> {
 
         template<typename Range1, typename Range2, typename Func>
             requires range<Range1> && range<Range2>
-        static void call_two(Range1 && r1, Range2 & r2, Func && f) {
-            static_assert(std::is_assignable_v<
+        static constexpr void call_two(Range1 && r1, Range2 & r2, Func && f) {
+            static_assert((std::is_assignable_v<
                 decltype(static_ranges::element<I>(r2)),
-                decltype(f(static_ranges::element<I>(std::forward<Range1>(r1))))>,
+                decltype(f(static_ranges::element<I>(std::forward<Range1>(r1))))> && ...),
                 TRANSFORM_ONE_ERROR);
 
-            static_ranges::element<I>(r2) = f(
-                static_ranges::element<I>(std::forward<Range1>(r1)));
-
-            transform_impl<std::index_sequence<Is ...>>::call_two(
-                std::forward<Range1>(r1),
-                r2,
-                std::forward<Func>(f));
+            (void)std::initializer_list<int>{ ((void)(static_ranges::element<I>(r2) = f(
+                static_ranges::element<I>(std::forward<Range1>(r1)))), 0)... };
         }
 
 
         template<typename Range1, typename Range2, typename Range3, typename Func>
             requires range<Range1> && range<Range2> && range<Range3> 
-        static void call_three(Range1 && r1, Range2 && r2, Range3 & r3, Func && f) {
-            static_assert(std::is_assignable_v<
+        static constexpr void call_three(Range1 && r1, Range2 && r2, Range3 & r3, Func && f) {
+            static_assert((std::is_assignable_v<
                 decltype(static_ranges::element<I>(r3)),
                 decltype(f(
                     static_ranges::element<I>(std::forward<Range1>(r1)),
-                    static_ranges::element<I>(std::forward<Range2>(r2))))>,
+                    static_ranges::element<I>(std::forward<Range2>(r2))))> && ...),
                 TRANSFORM_TWO_ERROR);
 
-            static_ranges::element<I>(r3) = f(
+            (void)std::initializer_list<int>{ ((void)(static_ranges::element<I>(r3) = f(
                 static_ranges::element<I>(std::forward<Range1>(r1)),
-                static_ranges::element<I>(std::forward<Range2>(r2)));
-
-            transform_impl<std::index_sequence<Is ...>>::call_three(
-                std::forward<Range1>(r1),
-                std::forward<Range2>(r2),
-                r3,
-                std::forward<Func>(f));
+                static_ranges::element<I>(std::forward<Range2>(r2)))), 0)... };
         }
     };
 
-    template<>
-    struct transform_impl<std::index_sequence<>> {
+
+    /*
+    * Run-time loop counterpart of transform_impl for contiguous ranges,
+    * which the compiler may vectorize. Elements are accessed through pointers
+    * to the first elements, forwarded with the value category element<I>
+    * would give them.
+    */
+    struct contiguous_transform_impl
+    {
+        template<typename Range>
+        static constexpr auto data(Range & r) {
+            return std::addressof(static_ranges::element<0>(r));
+        }
+
         template<typename Range1, typename Range2, typename Func>
-        static void call_two(Range1 && r1, Range2 & r2, Func && f) {}
+        static constexpr void call_two(Range1 && r1, Range2 & r2, Func && f) {
+            using ref1 = decltype(static_ranges::element<0>(std::forward<Range1>(r1)));
+
+            static_assert(std::is_assignable_v<
+                decltype(static_ranges::element<0>(r2)),
+                decltype(f(std::declval<ref1>()))>,
+                TRANSFORM_ONE_ERROR);
+
+            auto src = data(r1);
+            auto dest = data(r2);
+            for (std::size_t i = 0; i < range_nocvref<Range1>::value; ++i)
+                dest[i] = f(static_cast<ref1>(src[i]));
+        }
 
         template<typename Range1, typename Range2, typename Range3, typename Func>
-        static void call_three(Range1 && r1, Range2 && r2, Range3 & r3, Func && f) {}
+        static constexpr void call_three(Range1 && r1, Range2 && r2, Range3 & r3, Func && f) {
+            using ref1 = decltype(static_ranges::element<0>(std::forward<Range1>(r1)));
+            using ref2 = decltype(static_ranges::element<0>(std::forward<Range2>(r2)));
+
+            static_assert(std::is_assignable_v<
+                decltype(static_ranges::element<0>(r3)),
+                decltype(f(std::declval<ref1>(), std::declval<ref2>()))>,
+                TRANSFORM_TWO_ERROR);
+
+            auto src1 = data(r1);
+            auto src2 = data(r2);
+            auto dest = data(r3);
+            for (std::size_t i = 0; i < range_nocvref<Range1>::value; ++i)
+                dest[i] = f(static_cast<ref1>(src1[i]), static_cast<ref2>(src2[i]));
+        }
     };
 
 
@@ -165,10 +194,18 @@ namespace static_ranges {
     template<typename RangeSrc, typename RangeDest, typename Func>
         requires (range_nocvref<RangeSrc>::value == range_nocvref<RangeDest>::value)
     constexpr void transform(RangeSrc && r1, RangeDest & r2, Func && f) {
-        transform_impl<make_sequence<RangeSrc>>::call_two(
-            std::forward<RangeSrc>(r1),
-            r2,
-            std::forward<Func>(f));
+        if constexpr (contiguous_range<RangeSrc> && contiguous_range<RangeDest>) {
+            contiguous_transform_impl::call_two(
+                std::forward<RangeSrc>(r1),
+                r2,
+                std::forward<Func>(f));
+        }
+        else {
+            transform_impl<make_sequence<RangeSrc>>::call_two(
+                std::forward<RangeSrc>(r1),
+                r2,
+                std::forward<Func>(f));
+        }
     }
 
 
@@ -190,13 +227,111 @@ namespace static_ranges {
         requires (range_nocvref<RangeSrc1>::value == range_nocvref<RangeDest>::value &&
                   range_nocvref<RangeSrc1>::value == range_nocvref<RangeSrc2>::value)
     constexpr void transform(RangeSrc1 && r1, RangeSrc2 && r2, RangeDest & r3, Func && f) {
-        transform_impl<make_sequence<RangeSrc1>>::call_three(
-            std::forward<RangeSrc1>(r1),
-            std::forward<RangeSrc2>(r2),
-            r3,
-            std::forward<Func>(f));
+        if constexpr (contiguous_range<RangeSrc1> && contiguous_range<RangeSrc2> &&
+                      contiguous_range<RangeDest>) {
+            contiguous_transform_impl::call_three(
+                std::forward<RangeSrc1>(r1),
+                std::forward<RangeSrc2>(r2),
+                r3,
+                std::forward<Func>(f));
+        }
+        else {
+            transform_impl<make_sequence<RangeSrc1>>::call_three(
+                std::forward<RangeSrc1>(r1),
+                std::forward<RangeSrc2>(r2),
+                r3,
+                std::forward<Func>(f));
+        }
     }
 
+
+
+    template<typename Indices>
+    struct visit_at_impl;
+
+    template<std::size_t I0, std::size_t ... I>
+    struct visit_at_impl<std::index_sequence<I0, I ...>>
+    {
+        template<typename Range, typename Func>
+        using result_t = decltype(std::declval<Func &>()(
+            static_ranges::element<I0>(std::declval<Range>())));
+
+        template<std::size_t J, typename Range, typename Func>
+        static constexpr result_t<Range, Func> call_one(Range && r, Func & f) {
+            return f(static_ranges::element<J>(std::forward<Range>(r)));
+        }
+
+        template<typename Range, typename Func>
+        static constexpr result_t<Range, Func> (*table[])(Range &&, Func &) = {
+            &call_one<I0, Range, Func>, &call_one<I, Range, Func> ...
+        };
+
+        /*
+        * Calls f on the i-th element through a table of per-index functions,
+        * so the dispatch is a single indirect call whatever the size of r.
+        * i must be less than the size of r.
+        */
+        template<typename Range, typename Func>
+        static constexpr result_t<Range, Func> call(Range && r, std::size_t i, Func & f) {
+            static_assert((std::is_same_v<result_t<Range, Func>, decltype(f(
+                static_ranges::element<I>(std::forward<Range>(r))))> && ...),
+                VISIT_AT_RESULT_ERROR);
+
+            return table<Range, Func>[i](std::forward<Range>(r), f);
+        }
+    };
+
+
+    /*
+    * Given a static range r, a run-time index i and a functor f, return
+    * f(eI) for the element eI of r with index I == i.
+    * f(eI) must have the same type for all the elements of r.
+    * Throws std::out_of_range if i is not less than the size of r.
+    * 
+    * example:
+    * 
+    * std::tuple<int, double, std::string> r = { 42, 3.14, "Foo" };
+    * std::size_t field_id = read_field_id();
+    * static_ranges::visit_at(r, field_id, [](auto && v) { std::cout << v; });
+    */
+    template<typename Range, typename Func>
+        requires (range<std::remove_cvref_t<Range>> && range_nocvref<Range>::value != 0)
+    constexpr decltype(auto) visit_at(Range && r, std::size_t i, Func && f) {
+        if (i >= range_nocvref<Range>::value)
+            throw std::out_of_range("static_ranges::visit_at: index out of range");
+
+        return visit_at_impl<make_sequence<Range>>::call(std::forward<Range>(r), i, f);
+    }
+
+
+    /*
+    * Same as visit_at(r, i, f), except that otherwise() is returned if i
+    * is not less than the size of r. otherwise() must have the type of f(eI).
+    * 
+    * example:
+    * 
+    * bool found = static_ranges::visit_at(r, field_id,
+    *     [](auto && v) { std::cout << v; return true; },
+    *     [] { return false; });
+    */
+    template<typename Range, typename Func, typename Otherwise>
+        requires range<std::remove_cvref_t<Range>>
+    constexpr decltype(auto) visit_at(Range && r, std::size_t i, Func && f, Otherwise && otherwise) {
+        if constexpr (range_nocvref<Range>::value == 0) {
+            return otherwise();
+        }
+        else {
+            static_assert(std::is_same_v<
+                decltype(otherwise()),
+                typename visit_at_impl<make_sequence<Range>>::template result_t<Range, Func>>,
+                VISIT_AT_RESULT_ERROR);
+
+            if (i >= range_nocvref<Range>::value)
+                return otherwise();
+
+            return visit_at_impl<make_sequence<Range>>::call(std::forward<Range>(r), i, f);
+        }
+    }
 }
 
 #endif //__HELPERS_HPP__
\ No newline at end of file
@@ -0,0 +1,465 @@
+#ifndef __INSTRUMENTATION_HPP__
+#define __INSTRUMENTATION_HPP__
+
+/*
+* Per-element profiles of the algorithms and views. Not included by
+* static_ranges.hpp, so that code which does not profile does not parse
+* <ostream> and the timing intrinsics.
+*/
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <initializer_list>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+/*
+* Define to 1 to make the profiles record; otherwise they are empty and the
+* instrumented algorithms and views compile to the plain ones.
+*/
+#ifndef STATIC_RANGES_INSTRUMENTATION
+#define STATIC_RANGES_INSTRUMENTATION 0
+#endif
+
+#if STATIC_RANGES_INSTRUMENTATION
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define STATIC_RANGES_HAS_RDTSC
+#elif defined(_M_X64) || defined(_M_IX86)
+#include <intrin.h>
+#define STATIC_RANGES_HAS_RDTSC
+#endif
+#endif
+
+#include "range_traits.hpp"
+#include "convenience.hpp"
+#include "concepts.hpp"
+#include "helpers.hpp"
+#include "views.hpp"
+
+namespace static_ranges {
+
+    namespace instrumentation {
+
+        inline constexpr bool enabled = STATIC_RANGES_INSTRUMENTATION != 0;
+
+
+        /*
+        * The time stamp counter where there is one and STATIC_RANGES_INSTRUMENTATION
+        * is 1, 0 otherwise; the profiles always measure nanoseconds with
+        * std::chrono::steady_clock.
+        */
+        inline std::uint64_t cycles() noexcept {
+#ifdef STATIC_RANGES_HAS_RDTSC
+            return __rdtsc();
+#else
+            return 0;
+#endif
+        }
+
+
+        /*
+        * What a profile recorded for one index: the number of calls and
+        * their total duration.
+        */
+        struct sample
+        {
+            std::uint64_t calls = 0;
+            std::uint64_t nanoseconds = 0;
+            std::uint64_t cycles = 0;
+        };
+
+
+        /*
+        * Per-index call counts and timings of the work done on the elements
+        * of a static range of size N, recorded by the algorithms called with
+        * execution::instrumented(profile) and by views::instrumented(profile).
+        * A profile is not thread-safe.
+        *
+        * If Enabled is false (the default unless STATIC_RANGES_INSTRUMENTATION
+        * is 1), the profile is empty and records nothing.
+        *
+        * example:
+        *
+        * static_ranges::instrumentation::profile_for<decltype(shards)> profile("shards");
+        * static_ranges::for_each(static_ranges::execution::instrumented(profile), shards, [](auto & s) { s.run(); });
+        * profile.report(std::cout);
+        */
+        template<std::size_t N, bool Enabled = enabled>
+        class profile
+        {
+        public:
+
+            static constexpr std::size_t extent = N;
+
+            explicit profile(std::string_view name = {})
+                : m_name(name) {}
+
+            /*
+            * Returns f(), recording the call for index I.
+            */
+            template<std::size_t I, typename Func>
+            decltype(auto) measure(Func && f) {
+                static_assert(I < N, "index out of the profiled range");
+                scope s(m_samples[I]);
+                return std::forward<Func>(f)();
+            }
+
+            const sample & operator [] (std::size_t i) const {
+                if (i >= N)
+                    throw std::out_of_range("instrumentation::profile: index out of range");
+                return m_samples[i];
+            }
+
+            const std::string & name() const noexcept {
+                return m_name;
+            }
+
+            void reset() noexcept {
+                m_samples = {};
+            }
+
+            /*
+            * Writes a table of the samples, one line per index, with the
+            * share of the index in the total time.
+            */
+            void report(std::ostream & os) const {
+                std::uint64_t total = 0;
+                for (const auto & s : m_samples)
+                    total += s.nanoseconds;
+
+                char line[128];
+                os << "profile " << m_name << ": " << N << " elements, " << total << " ns\n";
+                std::snprintf(line, sizeof(line), "%8s %12s %14s %12s %14s %8s\n",
+                    "index", "calls", "ns", "ns/call", "cycles", "share");
+                os << line;
+                for (std::size_t i = 0; i < N; ++i) {
+                    const sample & s = m_samples[i];
+                    std::snprintf(line, sizeof(line), "%8zu %12llu %14llu %12.1f %14llu %7.1f%%\n",
+                        i,
+                        static_cast<unsigned long long>(s.calls),
+                        static_cast<unsigned long long>(s.nanoseconds),
+                        s.calls != 0 ? static_cast<double>(s.nanoseconds) / static_cast<double>(s.calls) : 0.0,
+                        static_cast<unsigned long long>(s.cycles),
+                        total != 0 ? 100.0 * static_cast<double>(s.nanoseconds) / static_cast<double>(total) : 0.0);
+                    os << line;
+                }
+            }
+
+        private:
+
+            /*
+            * Adds the duration of its lifetime to a sample, so the result of
+            * the measured call is returned as is, be it void or a reference.
+            */
+            struct scope
+            {
+                explicit scope(sample & s) noexcept
+                    : m_sample(s), m_cycles(cycles()), m_start(std::chrono::steady_clock::now()) {}
+
+                ~scope() {
+                    auto end = std::chrono::steady_clock::now();
+                    m_sample.cycles += cycles() - m_cycles;
+                    m_sample.nanoseconds += static_cast<std::uint64_t>(
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(end - m_start).count());
+                    ++m_sample.calls;
+                }
+
+                sample & m_sample;
+                std::uint64_t m_cycles;
+                std::chrono::steady_clock::time_point m_start;
+            };
+
+            std::string m_name;
+            std::array<sample, N> m_samples{};
+        };
+
+
+        /*
+        * Disabled profile: measure(f) is f().
+        */
+        template<std::size_t N>
+        class profile<N, false>
+        {
+        public:
+
+            static constexpr std::size_t extent = N;
+
+            constexpr explicit profile(std::string_view = {}) noexcept {}
+
+            template<std::size_t I, typename Func>
+            constexpr decltype(auto) measure(Func && f) {
+                static_assert(I < N, "index out of the profiled range");
+                return std::forward<Func>(f)();
+            }
+
+            sample operator [] (std::size_t i) const {
+                if (i >= N)
+                    throw std::out_of_range("instrumentation::profile: index out of range");
+                return {};
+            }
+
+            /*
+            * The name is not kept, so it is always empty.
+            */
+            const std::string & name() const noexcept {
+                static const std::string none;
+                return none;
+            }
+
+            constexpr void reset() noexcept {}
+
+            void report(std::ostream & os) const {
+                os << "profile: instrumentation disabled\n";
+            }
+        };
+
+
+        template<typename Range, bool Enabled = enabled>
+        using profile_for = profile<range_nocvref<Range>::value, Enabled>;
+
+
+        template<typename Indices>
+        struct instrumented_impl;
+
+        template<std::size_t ... I>
+        struct instrumented_impl<std::index_sequence<I ...>>
+        {
+            /*
+            * Calls op(std::integral_constant<std::size_t, I>()) for every I
+            * in order, each call measured for index I.
+            */
+            template<typename Profile, typename Op>
+            static constexpr void run(Profile & profile, Op & op) {
+                (void)std::initializer_list<int>{ ((void)profile.template measure<I>([&op] {
+                    op(std::integral_constant<std::size_t, I>());
+                }), 0)... };
+            }
+        };
+
+    } // instrumentation namespace
+
+
+    namespace execution {
+
+        /*
+        * Execution policy of the sequential algorithms which records the call
+        * for every element into a profile.
+        */
+        template<typename Profile>
+        struct instrumented_policy
+        {
+            Profile * m_profile;
+        };
+
+
+        /*
+        * Returns the policy recording into profile.
+        *
+        * example:
+        *
+        * static_ranges::transform(static_ranges::execution::instrumented(profile), r1, r2, f);
+        */
+        template<std::size_t N, bool Enabled>
+        constexpr instrumented_policy<instrumentation::profile<N, Enabled>> instrumented(
+            instrumentation::profile<N, Enabled> & profile) noexcept {
+            return { &profile };
+        }
+
+    } // execution namespace
+
+
+    /*
+    * for_each(r, f), measuring f(eI) for each index I.
+    */
+    template<typename Profile, typename Range, typename Func>
+        requires range<std::remove_cvref_t<Range>> && (Profile::extent == range_nocvref<Range>::value)
+    constexpr void for_each(const execution::instrumented_policy<Profile> & policy, Range && r, Func && f) {
+        auto op = [&]<std::size_t I>(std::integral_constant<std::size_t, I>) {
+            f(static_ranges::element<I>(std::forward<Range>(r)));
+        };
+        instrumentation::instrumented_impl<make_sequence<Range>>::run(*policy.m_profile, op);
+    }
+
+
+    /*
+    * copy(r1, r2), measuring the assignment of each index I.
+    */
+    template<typename Profile, typename RangeSrc, typename RangeDest>
+        requires (range_nocvref<RangeSrc>::value == range_nocvref<RangeDest>::value &&
+                  Profile::extent == range_nocvref<RangeSrc>::value)
+    constexpr void copy(const execution::instrumented_policy<Profile> & policy, RangeSrc && r1, RangeDest & r2) {
+        auto op = [&]<std::size_t I>(std::integral_constant<std::size_t, I>) {
+            static_assert(std::is_assignable_v<
+                decltype(static_ranges::element<I>(r2)),
+                decltype(static_ranges::element<I>(std::forward<RangeSrc>(r1)))>,
+                COPY_ASSIGN_ERROR);
+
+            static_ranges::element<I>(r2) = static_ranges::element<I>(std::forward<RangeSrc>(r1));
+        };
+        instrumentation::instrumented_impl<make_sequence<RangeSrc>>::run(*policy.m_profile, op);
+    }
+
+
+    /*
+    * transform(r1, r2, f), measuring f(e1I) and its assignment for each index I.
+    */
+    template<typename Profile, typename RangeSrc, typename RangeDest, typename Func>
+        requires (range_nocvref<RangeSrc>::value == range_nocvref<RangeDest>::value &&
+                  Profile::extent == range_nocvref<RangeSrc>::value)
+    constexpr void transform(const execution::instrumented_policy<Profile> & policy,
+                             RangeSrc && r1, RangeDest & r2, Func && f) {
+        auto op = [&]<std::size_t I>(std::integral_constant<std::size_t, I>) {
+            static_assert(std::is_assignable_v<
+                decltype(static_ranges::element<I>(r2)),
+                decltype(f(static_ranges::element<I>(std::forward<RangeSrc>(r1))))>,
+                TRANSFORM_ONE_ERROR);
+
+            static_ranges::element<I>(r2) = f(
+                static_ranges::element<I>(std::forward<RangeSrc>(r1)));
+        };
+        instrumentation::instrumented_impl<make_sequence<RangeSrc>>::run(*policy.m_profile, op);
+    }
+
+
+    /*
+    * transform(r1, r2, r3, f), measuring f(e1I, e2I) and its assignment for each index I.
+    */
+    template<typename Profile, typename RangeSrc1, typename RangeSrc2, typename RangeDest, typename Func>
+        requires (range_nocvref<RangeSrc1>::value == range_nocvref<RangeDest>::value &&
+                  range_nocvref<RangeSrc1>::value == range_nocvref<RangeSrc2>::value &&
+                  Profile::extent == range_nocvref<RangeSrc1>::value)
+    constexpr void transform(const execution::instrumented_policy<Profile> & policy,
+                             RangeSrc1 && r1, RangeSrc2 && r2, RangeDest & r3, Func && f) {
+        auto op = [&]<std::size_t I>(std::integral_constant<std::size_t, I>) {
+            static_assert(std::is_assignable_v<
+                decltype(static_ranges::element<I>(r3)),
+                decltype(f(
+                    static_ranges::element<I>(std::forward<RangeSrc1>(r1)),
+                    static_ranges::element<I>(std::forward<RangeSrc2>(r2))))>,
+                TRANSFORM_TWO_ERROR);
+
+            static_ranges::element<I>(r3) = f(
+                static_ranges::element<I>(std::forward<RangeSrc1>(r1)),
+                static_ranges::element<I>(std::forward<RangeSrc2>(r2)));
+        };
+        instrumentation::instrumented_impl<make_sequence<RangeSrc1>>::run(*policy.m_profile, op);
+    }
+
+
+    namespace views {
+
+        /*
+        * A static view object returned by static_views::instrumented. Its
+        * I-th element is the I-th element of m_view, obtained under
+        * m_profile->measure<I>, so for a transform view every lazy
+        * evaluation is recorded.
+        */
+        template<typename View, typename Profile>
+            requires static_ranges::view<View>
+        struct instrumented_view_object
+            : public static_ranges::view_base
+        {
+        public:
+
+            constexpr instrumented_view_object(View && view, Profile & profile)
+                : m_view(std::move(view)), m_profile(&profile) {}
+
+            View m_view;
+            Profile * m_profile;
+        };
+
+    } // views namespace
+
+
+    template<typename View, typename Profile>
+    using instrumented_view_object = static_views::instrumented_view_object<View, Profile>;
+
+
+    /**
+    * Partial specialization for instrumented_view_object.
+    */
+    template<typename View, typename Profile>
+    struct range_traits<instrumented_view_object<View, Profile>>
+        : std::integral_constant<std::size_t, range_nocvref<View>::value>
+    {
+        template<std::size_t I, typename Instrumented>
+        static constexpr decltype(auto) make(Instrumented && v)
+        {
+            return v.m_profile->template measure<I>([&v]() -> decltype(auto) {
+                return static_ranges::element<I>(std::forward<Instrumented>(v).m_view);
+            });
+        }
+
+        template<std::size_t I>
+        static constexpr decltype(auto) get(instrumented_view_object<View, Profile> && v)
+        {
+            return make<I>(std::move(v));
+        }
+
+        template<std::size_t I>
+        static constexpr decltype(auto) get(instrumented_view_object<View, Profile> & v)
+        {
+            return make<I>(v);
+        }
+
+        template<std::size_t I>
+        static constexpr decltype(auto) get(const instrumented_view_object<View, Profile> & v)
+        {
+            return make<I>(v);
+        }
+    };
+
+
+    namespace views {
+
+        /*
+        * Range adaptor closure object of views::instrumented.
+        */
+        template<typename Profile>
+        struct instrumented_closure {
+
+            template<typename Range>
+                requires static_ranges::range<std::remove_cvref_t<Range>> &&
+                         (Profile::extent == range_nocvref<Range>::value)
+            constexpr auto operator()(Range && r) const {
+                if constexpr (std::is_empty_v<Profile>)
+                    return all(std::forward<Range>(r));
+                else
+                    return instrumented_view_object(all(std::forward<Range>(r)), *m_profile);
+            }
+
+            Profile * m_profile;
+        };
+
+
+        /*
+        * Returns a range adaptor closure object which, applied to a static
+        * range, gives a static view recording every access to its I-th element
+        * into the profile for index I; placed after transform, it records the
+        * lazy evaluations of the transformation. With a disabled profile, the
+        * view is all(r).
+        *
+        * example:
+        *
+        * auto costs = shards | static_views::transform(estimate) | static_views::instrumented(profile);
+        * static_ranges::to_array<double>(costs);
+        * profile.report(std::cout);
+        */
+        template<std::size_t N, bool Enabled>
+        constexpr instrumented_closure<instrumentation::profile<N, Enabled>> instrumented(
+            instrumentation::profile<N, Enabled> & profile) noexcept {
+            return { &profile };
+        }
+
+    } // views namespace
+
+} // static_ranges namespace
+
+#endif // __INSTRUMENTATION_HPP__
@@ -0,0 +1,167 @@
+#ifndef __PACKED_TUPLE_HPP__
+#define __PACKED_TUPLE_HPP__
+
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "range_traits.hpp"
+
+namespace static_ranges {
+
+    /*
+    * The storage order of packed_tuple<Ts...>: the logical indices of Ts
+    * stably sorted by decreasing alignment, so that every member starts at
+    * an offset that is already suitably aligned and only tail padding remains.
+    */
+    template<typename ... Ts>
+    struct packed_order
+    {
+        static constexpr std::array<std::size_t, sizeof...(Ts)> order = [] {
+            constexpr std::array<std::size_t, sizeof...(Ts)> alignments = { alignof(Ts) ... };
+            std::array<std::size_t, sizeof...(Ts)> a{};
+            for (std::size_t i = 0; i < a.size(); ++i) {
+                std::size_t j = i;
+                for (; j > 0 && alignments[a[j - 1]] < alignments[i]; --j)
+                    a[j] = a[j - 1];
+                a[j] = i;
+            }
+            return a;
+        }();
+
+        template<std::size_t ... P>
+        static auto make(std::index_sequence<P ...>) -> std::index_sequence<order[P] ...>;
+
+        using type = decltype(make(std::index_sequence_for<Ts ...>()));
+    };
+
+
+    /*
+    * Holds the member of logical index I of a packed_tuple.
+    */
+    template<std::size_t I, typename T>
+    struct packed_leaf
+    {
+        constexpr packed_leaf()
+            : m_value() {}
+
+        template<typename Arg>
+        constexpr packed_leaf(std::in_place_t, Arg && arg)
+            : m_value(std::forward<Arg>(arg)) {}
+
+        [[no_unique_address]] T m_value;
+
+        constexpr bool operator == (const packed_leaf &) const = default;
+    };
+
+
+    template<typename Order, typename ... Ts>
+    struct packed_storage;
+
+    /*
+    * The leaves are base classes listed in storage order J..., so they are
+    * laid out in that order.
+    */
+    template<std::size_t ... J, typename ... Ts>
+    struct packed_storage<std::index_sequence<J ...>, Ts ...>
+        : packed_leaf<J, std::tuple_element_t<J, std::tuple<Ts ...>>> ...
+    {
+        constexpr packed_storage() = default;
+
+        template<typename Args>
+        constexpr explicit packed_storage(std::piecewise_construct_t, Args && args)
+            : packed_leaf<J, std::tuple_element_t<J, std::tuple<Ts ...>>>(
+                std::in_place, std::get<J>(std::forward<Args>(args))) ...
+        {}
+
+        constexpr bool operator == (const packed_storage &) const = default;
+    };
+
+
+    /*
+    * A tuple whose members are stored ordered by decreasing alignment rather
+    * than in declaration order, which minimizes the padding between them.
+    * Its elements are still accessed in declaration (logical) order, so it is
+    * a static range like std::tuple<Ts...>.
+    *
+    * example:
+    *
+    * static_ranges::packed_tuple<char, double, short, std::int64_t> t = { 'a', 3.14, 2, 42 };
+    * // sizeof(t) == 24, sizeof(std::tuple<char, double, short, std::int64_t>) == 32
+    * static_ranges::element<1>(t) += 1.0;
+    */
+    template<typename ... Ts>
+    class packed_tuple
+        : private packed_storage<typename packed_order<Ts ...>::type, Ts ...>
+    {
+        using storage = packed_storage<typename packed_order<Ts ...>::type, Ts ...>;
+
+        template<std::size_t I>
+        using leaf = packed_leaf<I, std::tuple_element_t<I, std::tuple<Ts ...>>>;
+
+    public:
+
+        constexpr packed_tuple() = default;
+
+        template<typename ... Args>
+            requires (sizeof...(Args) == sizeof...(Ts) && sizeof...(Ts) != 0 &&
+                      !(sizeof...(Args) == 1 && (std::is_same_v<std::remove_cvref_t<Args>, packed_tuple> && ...)) &&
+                      (std::is_constructible_v<Ts, Args> && ...))
+        constexpr explicit(!(std::is_convertible_v<Args, Ts> && ...)) packed_tuple(Args && ... args)
+            : storage(std::piecewise_construct, std::forward_as_tuple(std::forward<Args>(args) ...))
+        {}
+
+        template<std::size_t I>
+        constexpr auto & get() & noexcept {
+            return static_cast<leaf<I> &>(*this).m_value;
+        }
+
+        template<std::size_t I>
+        constexpr const auto & get() const & noexcept {
+            return static_cast<const leaf<I> &>(*this).m_value;
+        }
+
+        template<std::size_t I>
+        constexpr auto && get() && noexcept {
+            return std::move(static_cast<leaf<I> &>(*this).m_value);
+        }
+
+        constexpr bool operator == (const packed_tuple &) const = default;
+    };
+
+    template<typename ... Ts>
+    packed_tuple(Ts ...) -> packed_tuple<Ts ...>;
+
+
+    /*
+    * Partial specialization presenting the elements of a packed_tuple
+    * in logical order.
+    */
+    template<typename ... Ts>
+    struct range_traits<packed_tuple<Ts ...>>
+        : std::integral_constant<std::size_t, sizeof...(Ts)>
+    {
+        template<std::size_t I>
+        static constexpr decltype(auto) get(packed_tuple<Ts ...> && t)
+        {
+            return std::move(t).template get<I>();
+        }
+
+        template<std::size_t I>
+        static constexpr decltype(auto) get(packed_tuple<Ts ...> & t)
+        {
+            return t.template get<I>();
+        }
+
+        template<std::size_t I>
+        static constexpr decltype(auto) get(const packed_tuple<Ts ...> & t)
+        {
+            return t.template get<I>();
+        }
+    };
+
+} // static_ranges namespace
+
+#endif // __PACKED_TUPLE_HPP__
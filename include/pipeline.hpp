@@ -0,0 +1,76 @@
+#ifndef __PIPELINE_HPP__
+#define __PIPELINE_HPP__
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+#include "range_traits.hpp"
+#include "convenience.hpp"
+#include "concepts.hpp"
+#include "helpers.hpp"
+
+namespace static_ranges {
+
+    /*
+    * How run_pipeline applies the stages to the records of a batch:
+    *  - batched: every stage runs over a whole block of records before the
+    *    next stage starts, so each stage is a tight loop the compiler can
+    *    unroll and vectorize, and the block stays in cache between stages.
+    *  - fused: all the stages run on one record before moving to the next,
+    *    so every record is loaded once, but the loop body is all the stages.
+    */
+    enum class pipeline_mode {
+        batched,
+        fused
+    };
+
+
+    /*
+    * The default number of records a batched pipeline processes per block,
+    * small enough for a block of small records to stay in the L1 cache.
+    */
+    inline constexpr std::size_t pipeline_block_size = 1024;
+
+
+    /*
+    * Given a static range of stages, i.e. functors callable as stage(record)
+    * with a Record &, and a batch of records, apply every stage to every
+    * record, the stages in index order for each record. The mode is chosen
+    * at compile time; in batched mode the batch is processed in blocks of
+    * Block records (the whole batch at once if Block is 0).
+    *
+    * example:
+    *
+    * auto stages = std::make_tuple(
+    *     [](record & r) { r.value *= r.scale; },
+    *     [](record & r) { r.value = std::clamp(r.value, 0.0f, 1.0f); },
+    *     [](record & r) { r.flag = r.value > 0.5f; });
+    *
+    * static_ranges::run_pipeline(stages, std::span(records));
+    * static_ranges::run_pipeline<static_ranges::pipeline_mode::fused>(stages, std::span(records));
+    */
+    template<pipeline_mode Mode = pipeline_mode::batched, std::size_t Block = pipeline_block_size,
+             typename Stages, typename Record, std::size_t Extent>
+        requires range<std::remove_cvref_t<Stages>>
+    constexpr void run_pipeline(Stages && stages, std::span<Record, Extent> batch) {
+        if constexpr (Mode == pipeline_mode::fused) {
+            for (Record & record : batch)
+                static_ranges::for_each(stages, [&record](auto & stage) { stage(record); });
+        }
+        else {
+            const std::size_t block = Block == 0 ? batch.size() : Block;
+            for (std::size_t begin = 0; begin < batch.size(); begin += block) {
+                auto records = batch.subspan(begin, std::min(block, batch.size() - begin));
+                static_ranges::for_each(stages, [records](auto & stage) {
+                    for (Record & record : records)
+                        stage(record);
+                });
+            }
+        }
+    }
+
+} // static_ranges namespace
+
+#endif // __PIPELINE_HPP__
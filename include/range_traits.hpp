@@ -1,6 +1,8 @@
 #ifndef __RANGE_TRAITS_HPP__
 #define __RANGE_TRAITS_HPP__
 
+#include <array>
+#include <functional>
 #include <type_traits>
 #include <tuple>
 #include <utility>
@@ -44,35 +46,69 @@ namespace static_ranges {
         }
     };
 
+    /*
+    * Opt-in flag for static ranges whose elements all have the same type and
+    * are stored contiguously, in index order, in an array, so that the address
+    * of the I-th element is std::addressof(get<0>(r)) + I.
+    * Algorithms may process such ranges with run-time loops.
+    */
+    template<typename Range>
+    inline constexpr bool enable_contiguous_range = false;
+
+    template<typename T, std::size_t N>
+    inline constexpr bool enable_contiguous_range<std::array<T, N>> = true;
+
+
     template<typename T>
     using nocvref_range = static_ranges::range_traits<std::remove_cvref_t<T>>;
 
 
+    template<typename T>
+    struct is_reference_wrapper : std::false_type {};
+
+    template<typename T>
+    struct is_reference_wrapper<std::reference_wrapper<T>> : std::true_type {};
+
+    /*
+    * The range held in the m_data member of a view object: the referenced
+    * range if m_data is a std::reference_wrapper (with its constness, and
+    * as an lvalue whatever the value category of the view), else m_data itself.
+    */
+    template<typename Data>
+    constexpr decltype(auto) view_data(Data && data) noexcept {
+        if constexpr (is_reference_wrapper<std::remove_cvref_t<Data>>::value)
+            return data.get();
+        else
+            return std::forward<Data>(data);
+    }
+
+
     /**
     * Partial specialization for when view obj encapsulates
-    * the range. 
+    * the range (in its m_data member). 
     */
     template< template<typename> typename View, typename Range>
-        requires std::is_base_of_v<view_base, View<Range>>
+        requires std::is_base_of_v<view_base, View<Range>> &&
+                 requires (View<Range> & v) { v.m_data; }
     struct range_traits<View<Range>> 
         : std::integral_constant<std::size_t, nocvref_range<Range>::value>
     {
         template<std::size_t I>
         static constexpr decltype(auto) get(View<Range> && t)
         {
-            return nocvref_range<Range>::template get<I>(std::move(t).m_data);
+            return nocvref_range<Range>::template get<I>(view_data(std::move(t).m_data));
         }
 
         template<std::size_t I>
         static constexpr decltype(auto) get(View<Range> & t)
         {
-            return nocvref_range<Range>::template get<I>(t.m_data);
+            return nocvref_range<Range>::template get<I>(view_data(t.m_data));
         }
 
         template<std::size_t I>
         static constexpr decltype(auto) get(const View<Range> & t)
         {
-            return nocvref_range<Range>::template get<I>(t.m_data);
+            return nocvref_range<Range>::template get<I>(view_data(t.m_data));
         }
     };
 
@@ -0,0 +1,371 @@
+#ifndef __SERIALIZE_HPP__
+#define __SERIALIZE_HPP__
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "range_traits.hpp"
+#include "convenience.hpp"
+#include "concepts.hpp"
+
+
+#define SERIALIZE_ELEMENT_ERROR "Every element of a serialized static range must be trivially copyable or a static range itself"
+
+namespace static_ranges {
+
+    /*
+    * The type of the I-th element of Range, without references and cv-qualifiers.
+    */
+    template<typename Range, std::size_t I>
+    using serialized_element_t = std::remove_cvref_t<
+        decltype(static_ranges::element<I>(std::declval<Range &>()))>;
+
+
+    /*
+    * The packed binary layout of a type: static ranges are laid out as their
+    * elements one after the other, without padding, recursively; any other
+    * type is a leaf, stored as its object representation (in native byte
+    * order) and must be trivially copyable.
+    *
+    * size is the number of bytes of the serialized value, offsets[I] the
+    * offset of the I-th element of a static range. trivial_run is true if
+    * the object representation of the value is its serialized form, so it
+    * can be copied with a single memcpy.
+    */
+    template<typename T, typename Indices = void>
+    struct serialized_layout
+    {
+        static_assert(std::is_trivially_copyable_v<T>, SERIALIZE_ELEMENT_ERROR);
+
+        static constexpr std::size_t size = sizeof(T);
+        static constexpr bool trivial_run = true;
+    };
+
+    template<typename Range>
+        requires static_ranges::range<Range>
+    struct serialized_layout<Range, void>
+        : serialized_layout<Range, make_sequence<Range>>
+    {};
+
+    template<typename Range, std::size_t ... I>
+    struct serialized_layout<Range, std::index_sequence<I ...>>
+    {
+        static constexpr std::array<std::size_t, sizeof...(I)> sizes = {
+            serialized_layout<serialized_element_t<Range, I>>::size ...
+        };
+
+        static constexpr std::array<std::size_t, sizeof...(I)> offsets = [] {
+            std::array<std::size_t, sizeof...(I)> a{};
+            std::size_t offset = 0;
+            for (std::size_t i = 0; i < a.size(); ++i) {
+                a[i] = offset;
+                offset += sizes[i];
+            }
+            return a;
+        }();
+
+        static constexpr std::size_t size = [] {
+            std::size_t n = 0;
+            for (std::size_t s : sizes)
+                n += s;
+            return n;
+        }();
+
+        /*
+        * Only contiguous ranges are known to store their elements in index
+        * order without padding; their elements must in turn be trivial runs.
+        */
+        static constexpr bool trivial_run = [] {
+            if constexpr (contiguous_range<Range>) {
+                using value_type = serialized_element_t<Range, 0>;
+                return serialized_layout<value_type>::trivial_run &&
+                       serialized_layout<value_type>::size == sizeof(value_type) &&
+                       sizeof(Range) == sizeof...(I) * sizeof(value_type);
+            }
+            else {
+                return false;
+            }
+        }();
+    };
+
+
+    /*
+    * The number of bytes static_ranges::serialize writes for a value of type T.
+    */
+    template<typename T>
+    inline constexpr std::size_t serialized_size_v = serialized_layout<std::remove_cvref_t<T>>::size;
+
+
+    template<typename T>
+    struct serializer;
+
+    template<typename Indices>
+    struct serializer_impl;
+
+    template<std::size_t ... I>
+    struct serializer_impl<std::index_sequence<I ...>>
+    {
+        /*
+        * Whether the I-th element is stored as its object representation
+        * and accessed by reference, so it can be copied together with the
+        * elements next to it.
+        */
+        template<typename Range, std::size_t J>
+        static constexpr bool block =
+            std::is_lvalue_reference_v<decltype(static_ranges::element<J>(std::declval<Range &>()))> &&
+            serialized_layout<serialized_element_t<Range, J>>::trivial_run &&
+            serialized_layout<serialized_element_t<Range, J>>::size == sizeof(serialized_element_t<Range, J>);
+
+        /*
+        * The address of the J-th element if it is a block, nullptr otherwise.
+        */
+        template<std::size_t J, typename Range>
+        static auto * address(Range & r) {
+            using byte_type = std::conditional_t<std::is_const_v<Range>, const std::byte, std::byte>;
+            if constexpr (block<std::remove_const_t<Range>, J>)
+                return reinterpret_cast<byte_type *>(std::addressof(static_ranges::element<J>(r)));
+            else
+                return static_cast<byte_type *>(nullptr);
+        }
+
+        /*
+        * The maximal runs of consecutive block elements: run_begin[J] and
+        * run_end[J] delimit the run of the J-th element (just J if it is
+        * not a block). Their serialized forms are always adjacent.
+        */
+        template<typename Range>
+        struct runs
+        {
+            static constexpr std::array<bool, sizeof...(I)> blocks = { block<Range, I> ... };
+
+            static constexpr std::array<std::size_t, sizeof...(I)> run_begin = [] {
+                std::array<std::size_t, sizeof...(I)> a{};
+                for (std::size_t j = 0; j < a.size(); ++j)
+                    a[j] = j != 0 && blocks[j] && blocks[j - 1] ? a[j - 1] : j;
+                return a;
+            }();
+
+            static constexpr std::array<std::size_t, sizeof...(I)> run_end = [] {
+                std::array<std::size_t, sizeof...(I)> a{};
+                for (std::size_t j = a.size(); j-- != 0; )
+                    a[j] = j + 1 != a.size() && blocks[j] && blocks[j + 1] ? a[j + 1] : j + 1;
+                return a;
+            }();
+
+            /*
+            * Given the addresses of the elements, returns for every J whether
+            * the elements J to run_end[J] - 1 are also adjacent in memory, in
+            * which case the run from J on is copied with a single memcpy.
+            * That is known only from the addresses, e.g. it is true for
+            * std::pair<int, int>, and false for std::tuple<int, int> of
+            * libstdc++, which stores its elements in reverse order.
+            */
+            template<typename Byte>
+            static std::array<bool, sizeof...(I)> adjacent(Byte * const (& objects)[sizeof...(I)]) {
+                constexpr auto sizes = serialized_layout<Range>::sizes;
+                std::array<bool, sizeof...(I)> a{};
+                for (std::size_t j = a.size(); j-- != 0; )
+                    a[j] = j + 1 == run_end[j] ||
+                           (objects[j + 1] == objects[j] + sizes[j] && a[j + 1]);
+                return a;
+            }
+
+            static constexpr std::size_t run_size(std::size_t j) {
+                using layout = serialized_layout<Range>;
+                return layout::offsets[run_end[j] - 1] + layout::sizes[run_end[j] - 1] - layout::offsets[j];
+            }
+        };
+
+        template<typename Range>
+        static void write([[maybe_unused]] const Range & r, [[maybe_unused]] std::byte * out) {
+            if constexpr (sizeof...(I) != 0) {
+                using layout = serialized_layout<Range>;
+                using run = runs<Range>;
+
+                const std::byte * const objects[] = { address<I>(r) ... };
+                const auto adjacent = run::adjacent(objects);
+
+                (void)std::initializer_list<int>{ ((void)[&] {
+                    constexpr std::size_t begin = run::run_begin[I];
+                    if constexpr (block<Range, I>) {
+                        if (adjacent[begin]) {
+                            if constexpr (begin == I)
+                                std::memcpy(out + layout::offsets[I], objects[I], run::run_size(I));
+                            return;
+                        }
+                    }
+                    serializer<serialized_element_t<Range, I>>::write(
+                        static_ranges::element<I>(r), out + layout::offsets[I]);
+                }(), 0)... };
+            }
+        }
+
+        template<typename Range>
+        static void read([[maybe_unused]] Range & r, [[maybe_unused]] const std::byte * in) {
+            if constexpr (sizeof...(I) != 0) {
+                using layout = serialized_layout<Range>;
+                using run = runs<Range>;
+
+                std::byte * const objects[] = { address<I>(r) ... };
+                const auto adjacent = run::adjacent(objects);
+
+                (void)std::initializer_list<int>{ ((void)[&] {
+                    constexpr std::size_t begin = run::run_begin[I];
+                    if constexpr (block<Range, I>) {
+                        if (adjacent[begin]) {
+                            if constexpr (begin == I)
+                                std::memcpy(objects[I], in + layout::offsets[I], run::run_size(I));
+                            return;
+                        }
+                    }
+                    serializer<serialized_element_t<Range, I>>::read(
+                        static_ranges::element<I>(r), in + layout::offsets[I]);
+                }(), 0)... };
+            }
+        }
+    };
+
+    /*
+    * Writes a value of type T to / reads it from its serialized_layout.
+    * Trivial runs are copied with a single memcpy, other static ranges
+    * element by element, merging the copies of neighbouring trivially
+    * copyable elements which are adjacent in memory.
+    */
+    template<typename T>
+    struct serializer
+    {
+        static void write(const T & v, std::byte * out) {
+            if constexpr (serialized_layout<T>::trivial_run)
+                std::memcpy(out, std::addressof(v), sizeof(T));
+            else
+                serializer_impl<make_sequence<T>>::write(v, out);
+        }
+
+        static void read(T & v, const std::byte * in) {
+            if constexpr (serialized_layout<T>::trivial_run)
+                std::memcpy(std::addressof(v), in, sizeof(T));
+            else
+                serializer_impl<make_sequence<T>>::read(v, in);
+        }
+    };
+
+
+    /*
+    * Writes the static range r to the beginning of buffer in its packed
+    * serialized_layout and returns the part of the buffer written to,
+    * i.e. its first serialized_size_v<Range> bytes.
+    * Throws std::length_error if buffer is too small.
+    *
+    * example:
+    *
+    * std::tuple<int, std::array<double, 3>, char> r = { 42, { 1.0, 2.0, 3.0 }, 'a' };
+    * std::array<std::byte, static_ranges::serialized_size_v<decltype(r)>> buffer;
+    * static_ranges::serialize(r, buffer); // 4 + 24 + 1 bytes, the array in one memcpy
+    */
+    template<typename Range>
+        requires static_ranges::range<std::remove_cvref_t<Range>>
+    std::span<std::byte> serialize(const Range & r, std::span<std::byte> buffer) {
+        constexpr std::size_t size = serialized_size_v<Range>;
+        if (buffer.size() < size)
+            throw std::length_error("static_ranges::serialize: buffer too small");
+
+        serializer<std::remove_cvref_t<Range>>::write(r, buffer.data());
+        return buffer.first(size);
+    }
+
+
+    /*
+    * Reads a static range of type Range from the beginning of bytes, which
+    * shall hold what static_ranges::serialize wrote for a Range.
+    * Range must be default-constructible.
+    * Throws std::length_error if bytes is too small.
+    */
+    template<typename Range>
+        requires static_ranges::range<Range> && std::is_default_constructible_v<Range>
+    Range deserialize(std::span<const std::byte> bytes) {
+        if (bytes.size() < serialized_size_v<Range>)
+            throw std::length_error("static_ranges::deserialize: buffer too small");
+
+        Range r;
+        serializer<Range>::read(r, bytes.data());
+        return r;
+    }
+
+
+    /*
+    * A static view over a serialized Range, which decodes only the elements
+    * that are accessed: the I-th element is read from its offset in the
+    * buffer, either as a copy of a leaf value or, for a nested static range,
+    * as a serialized_view over its bytes.
+    */
+    template<typename Range>
+        requires static_ranges::range<Range>
+    struct serialized_view
+        : public static_ranges::view_base
+    {
+    public:
+
+        constexpr explicit serialized_view(std::span<const std::byte> bytes)
+            : m_bytes(bytes) {}
+
+        std::span<const std::byte> m_bytes;
+    };
+
+
+    template<typename Range>
+    struct range_traits<serialized_view<Range>>
+        : std::integral_constant<std::size_t, range_traits<Range>::value>
+    {
+        template<std::size_t I>
+        static auto get(const serialized_view<Range> & v)
+        {
+            using element_type = serialized_element_t<Range, I>;
+            using layout = serialized_layout<element_type>;
+            const std::byte * in = v.m_bytes.data() + serialized_layout<Range>::offsets[I];
+
+            if constexpr (static_ranges::range<element_type>) {
+                return serialized_view<element_type>(std::span<const std::byte>(in, layout::size));
+            }
+            else {
+                std::array<std::byte, sizeof(element_type)> raw;
+                std::memcpy(raw.data(), in, sizeof(element_type));
+                return std::bit_cast<element_type>(raw);
+            }
+        }
+    };
+
+
+    namespace views {
+
+        /*
+        * Returns a static view that reads the elements of the Range serialized
+        * at the beginning of bytes in place, without decoding the whole record.
+        * Throws std::length_error if bytes is too small.
+        *
+        * example:
+        *
+        * auto record = static_views::serialized<std::tuple<int, std::array<double, 3>>>(buffer);
+        * double y = static_ranges::element<1>(static_ranges::element<1>(record)); // reads 8 bytes
+        */
+        template<typename Range>
+            requires static_ranges::range<Range>
+        serialized_view<Range> serialized(std::span<const std::byte> bytes) {
+            if (bytes.size() < serialized_size_v<Range>)
+                throw std::length_error("static_views::serialized: buffer too small");
+
+            return serialized_view<Range>(bytes.first(serialized_size_v<Range>));
+        }
+
+    } // views namespace
+
+} // static_ranges namespace
+
+#endif // __SERIALIZE_HPP__
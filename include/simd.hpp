@@ -0,0 +1,148 @@
+#ifndef __SIMD_HPP__
+#define __SIMD_HPP__
+
+/*
+* Vectorized algorithms for contiguous static ranges of arithmetic elements.
+* Not included by static_ranges.hpp, since <experimental/simd> alone costs
+* more to parse than the rest of the library.
+*/
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#if __has_include(<experimental/simd>)
+#include <experimental/simd>
+#define STATIC_RANGES_HAS_SIMD
+#endif
+
+#include "range_traits.hpp"
+#include "convenience.hpp"
+#include "concepts.hpp"
+#include "helpers.hpp"
+#include "execution.hpp"
+
+namespace static_ranges {
+
+    namespace execution {
+
+        /*
+        * Execution policy for contiguous ranges of arithmetic elements: the
+        * functor is applied to whole SIMD vectors of elements at once, so it
+        * must accept both the element type and std::experimental::native_simd
+        * of it (e.g. a generic lambda using arithmetic operators only).
+        *
+        * example:
+        *
+        * std::array<float, 1024> a, b;
+        * static_ranges::transform(static_ranges::execution::unseq, a, b, [](auto x) { return x * 2 + 1; });
+        */
+        struct unsequenced_policy
+        {};
+
+        inline constexpr unsequenced_policy unseq{};
+
+    } // execution namespace
+
+
+    /*
+    * Satisfied by contiguous ranges whose element type may be held by
+    * a SIMD vector, i.e. an arithmetic type other than bool.
+    */
+    template<typename Range>
+    concept simd_range =
+        contiguous_range<Range> &&
+        std::is_arithmetic_v<contiguous_value_t<Range>> &&
+        !std::is_same_v<contiguous_value_t<Range>, bool>;
+
+
+    /*
+    * Kernels used by transform(execution::unseq, ...): whole native SIMD
+    * vectors first, then the remaining elements one by one.
+    * Without <experimental/simd>, only the scalar loop remains.
+    */
+    struct simd_transform_impl
+    {
+        template<typename T, typename U, typename Func>
+        static void call_two(const T * src, U * dest, std::size_t n, Func & f) {
+            std::size_t i = 0;
+#ifdef STATIC_RANGES_HAS_SIMD
+            namespace stdx = std::experimental;
+            using vector = stdx::native_simd<T>;
+
+            for (const std::size_t whole = n - n % vector::size(); i < whole; i += vector::size())
+                f(vector(src + i, stdx::element_aligned)).copy_to(dest + i, stdx::element_aligned);
+#endif
+            for (; i < n; ++i)
+                dest[i] = f(src[i]);
+        }
+
+        template<typename T, typename U, typename Func>
+        static void call_three(const T * src1, const T * src2, U * dest, std::size_t n, Func & f) {
+            std::size_t i = 0;
+#ifdef STATIC_RANGES_HAS_SIMD
+            namespace stdx = std::experimental;
+            using vector = stdx::native_simd<T>;
+
+            for (const std::size_t whole = n - n % vector::size(); i < whole; i += vector::size())
+                f(vector(src1 + i, stdx::element_aligned), vector(src2 + i, stdx::element_aligned))
+                    .copy_to(dest + i, stdx::element_aligned);
+#endif
+            for (; i < n; ++i)
+                dest[i] = f(src1[i], src2[i]);
+        }
+    };
+
+
+    /*
+    * Vectorized version of transform(r1, r2, f) for contiguous ranges of
+    * arithmetic elements. Other ranges are processed by transform(r1, r2, f).
+    */
+    template<typename RangeSrc, typename RangeDest, typename Func>
+        requires (range_nocvref<RangeSrc>::value == range_nocvref<RangeDest>::value)
+    void transform(const execution::unsequenced_policy &, RangeSrc && r1, RangeDest & r2, Func && f) {
+        if constexpr (simd_range<RangeSrc> && simd_range<RangeDest>) {
+            simd_transform_impl::call_two(
+                std::addressof(static_ranges::element<0>(r1)),
+                std::addressof(static_ranges::element<0>(r2)),
+                size_v<RangeSrc>,
+                f);
+        }
+        else {
+            static_ranges::transform(std::forward<RangeSrc>(r1), r2, std::forward<Func>(f));
+        }
+    }
+
+
+    /*
+    * Vectorized version of transform(r1, r2, r3, f) for contiguous ranges of
+    * arithmetic elements, where r1 and r2 have the same element type.
+    * Other ranges are processed by transform(r1, r2, r3, f).
+    */
+    template<typename RangeSrc1, typename RangeSrc2, typename RangeDest, typename Func>
+        requires (range_nocvref<RangeSrc1>::value == range_nocvref<RangeDest>::value &&
+                  range_nocvref<RangeSrc1>::value == range_nocvref<RangeSrc2>::value)
+    void transform(const execution::unsequenced_policy &,
+                   RangeSrc1 && r1, RangeSrc2 && r2, RangeDest & r3, Func && f) {
+        if constexpr (simd_range<RangeSrc1> && simd_range<RangeSrc2> && simd_range<RangeDest> &&
+                      std::is_same_v<contiguous_value_t<RangeSrc1>, contiguous_value_t<RangeSrc2>>) {
+            simd_transform_impl::call_three(
+                std::addressof(static_ranges::element<0>(r1)),
+                std::addressof(static_ranges::element<0>(r2)),
+                std::addressof(static_ranges::element<0>(r3)),
+                size_v<RangeSrc1>,
+                f);
+        }
+        else {
+            static_ranges::transform(
+                std::forward<RangeSrc1>(r1),
+                std::forward<RangeSrc2>(r2),
+                r3,
+                std::forward<Func>(f));
+        }
+    }
+
+} // static_ranges namespace
+
+#endif // __SIMD_HPP__
@@ -0,0 +1,248 @@
+#ifndef __SOA_HPP__
+#define __SOA_HPP__
+
+#include <cstddef>
+#include <initializer_list>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "range_traits.hpp"
+#include "convenience.hpp"
+#include "concepts.hpp"
+#include "helpers.hpp"
+
+namespace static_ranges {
+
+    /*
+    * The type stored in the I-th column of a soa_table<Range>, i.e. the
+    * type of the I-th element of Range without references and cv-qualifiers.
+    */
+    template<typename Range, std::size_t I>
+    using column_t = std::remove_cvref_t<
+        decltype(static_ranges::element<I>(std::declval<Range &>()))>;
+
+
+    template<typename Range, typename Indices>
+    struct soa_columns;
+
+    template<typename Range, std::size_t ... I>
+    struct soa_columns<Range, std::index_sequence<I ...>>
+    {
+        static_assert((!std::is_same_v<column_t<Range, I>, bool> && ...),
+            "soa_table: bool elements are not supported, std::vector<bool> has no contiguous storage to span");
+
+        using type = std::tuple<std::vector<column_t<Range, I>> ...>;
+    };
+
+
+    /*
+    * A reference to one row of a soa_table, i.e. a static view whose I-th
+    * element is a reference to the row's entry in the I-th column.
+    * Table is soa_table<Range> or const soa_table<Range>.
+    */
+    template<typename Table>
+    struct soa_row
+        : public static_ranges::view_base
+    {
+    public:
+
+        constexpr soa_row(Table & table, std::size_t index)
+            : m_table(&table), m_index(index) {}
+
+        Table * m_table;
+        std::size_t m_index;
+    };
+
+
+    /*
+    * Struct-of-arrays storage of static ranges of type Range: the I-th
+    * elements of all stored ranges are kept in one contiguous column, so
+    * a scan of one column touches only the bytes of that column.
+    *
+    * example:
+    *
+    * static_ranges::soa_table<example_s> table;
+    * table.push_back(example_s{ 42, 3.14, "Foo" });
+    *
+    * auto row = table[0];                      // soa_row, a static view
+    * static_ranges::element<2>(row) += "Bar";  // modifies the w column
+    *
+    * for (double v : table.column<1>()) { ... }
+    * static_ranges::for_each(table.columns(), [](auto column) { ... });
+    *
+    * Range must have at least one element: the size of the table is the
+    * size of its columns, and a table without columns would have none.
+    */
+    template<typename Range>
+        requires (static_ranges::range<Range> && range_nocvref<Range>::value != 0)
+    class soa_table
+    {
+    public:
+
+        using columns_type = typename soa_columns<Range, make_sequence<Range>>::type;
+
+        std::size_t size() const noexcept {
+            return std::get<0>(m_columns).size();
+        }
+
+        bool empty() const noexcept {
+            return size() == 0;
+        }
+
+        void reserve(std::size_t n) {
+            static_ranges::for_each(m_columns, [n](auto & column) { column.reserve(n); });
+        }
+
+        void resize(std::size_t n) {
+            static_ranges::for_each(m_columns, [n](auto & column) { column.resize(n); });
+        }
+
+        void clear() noexcept {
+            static_ranges::for_each(m_columns, [](auto & column) { column.clear(); });
+        }
+
+        /*
+        * Appends the elements of r (any static range with the same number
+        * of elements) to the columns; they are moved if r is an rvalue.
+        * If appending an element throws, the elements already appended to
+        * the preceding columns are removed again, so the table is unchanged
+        * (though elements already moved out of r are lost).
+        */
+        template<typename Src>
+            requires (range_nocvref<Src>::value == range_nocvref<Range>::value)
+        void push_back(Src && r) {
+            push_back_impl(std::forward<Src>(r), make_sequence<Range>());
+        }
+
+        soa_row<soa_table> operator[](std::size_t i) {
+            return { *this, i };
+        }
+
+        soa_row<const soa_table> operator[](std::size_t i) const {
+            return { *this, i };
+        }
+
+        /*
+        * Returns a copy of the i-th row as a Range.
+        */
+        Range get(std::size_t i) const
+            requires std::is_default_constructible_v<Range>
+        {
+            Range r;
+            static_ranges::copy((*this)[i], r);
+            return r;
+        }
+
+        template<std::size_t I>
+        std::span<column_t<Range, I>> column() noexcept {
+            return std::get<I>(m_columns);
+        }
+
+        template<std::size_t I>
+        std::span<const column_t<Range, I>> column() const noexcept {
+            return std::get<I>(m_columns);
+        }
+
+        /*
+        * Returns a static range (a std::tuple) of spans over all the
+        * columns, for column-wise processing with the static range algorithms.
+        */
+        auto columns() noexcept {
+            return columns_impl(*this, make_sequence<Range>());
+        }
+
+        auto columns() const noexcept {
+            return columns_impl(*this, make_sequence<Range>());
+        }
+
+    private:
+
+        template<typename Src, std::size_t ... I>
+        void push_back_impl(Src && r, std::index_sequence<I ...>) {
+            std::size_t pushed = 0;
+            try {
+                (void)std::initializer_list<int>{ ((void)std::get<I>(m_columns).push_back(
+                    static_ranges::element<I>(std::forward<Src>(r))), (void)++pushed, 0)... };
+            }
+            catch (...) {
+                (void)std::initializer_list<int>{ ((void)(I < pushed ? std::get<I>(m_columns).pop_back() : void()), 0)... };
+                throw;
+            }
+        }
+
+        template<typename Table, std::size_t ... I>
+        static auto columns_impl(Table & table, std::index_sequence<I ...>) {
+            return std::make_tuple(table.template column<I>() ...);
+        }
+
+        columns_type m_columns;
+    };
+
+
+    /*
+    * Partial specialization making the rows of a soa_table static ranges.
+    */
+    template<typename Table>
+    struct range_traits<soa_row<Table>>
+        : std::integral_constant<std::size_t, std::tuple_size_v<typename std::remove_const_t<Table>::columns_type>>
+    {
+        template<std::size_t I>
+        static constexpr decltype(auto) get(const soa_row<Table> & row)
+        {
+            return row.m_table->template column<I>()[row.m_index];
+        }
+    };
+
+
+    /*
+    * Column-wise for_each: calls f(e) for every entry e of every column
+    * of the table, one column after the other.
+    */
+    template<typename Table, typename Func>
+        requires requires (Table & t) { t.columns(); }
+    void for_each_column(Table & table, Func && f) {
+        static_ranges::for_each(table.columns(), [&f](auto column) {
+            for (auto & e : column)
+                f(e);
+        });
+    }
+
+
+    template<typename Indices>
+    struct transform_columns_impl;
+
+    template<std::size_t ... I>
+    struct transform_columns_impl<std::index_sequence<I ...>>
+    {
+        template<typename TableSrc, typename TableDest, typename Func>
+        static void call(const TableSrc & src, TableDest & dest, Func & f) {
+            (void)std::initializer_list<int>{ ((void)call_one(
+                src.template column<I>(), dest.template column<I>(), f), 0)... };
+        }
+
+        template<typename ColumnSrc, typename ColumnDest, typename Func>
+        static void call_one(ColumnSrc src, ColumnDest dest, Func & f) {
+            for (std::size_t i = 0; i < src.size(); ++i)
+                dest[i] = f(src[i]);
+        }
+    };
+
+
+    /*
+    * Column-wise transform: resizes dest to the size of src and assigns
+    * f(e) to the entry of dest corresponding to every entry e of src,
+    * one column after the other.
+    */
+    template<typename RangeSrc, typename RangeDest, typename Func>
+        requires (range_nocvref<RangeSrc>::value == range_nocvref<RangeDest>::value)
+    void transform_columns(const soa_table<RangeSrc> & src, soa_table<RangeDest> & dest, Func && f) {
+        dest.resize(src.size());
+        transform_columns_impl<make_sequence<RangeSrc>>::call(src, dest, f);
+    }
+
+} // static_ranges namespace
+
+#endif // __SOA_HPP__
@@ -2,8 +2,12 @@
 #define __STD_HPP__
 
 #include <array>
+#include <memory>
+#include <memory_resource>
+#include <new>
 #include <tuple>
 #include <type_traits>
+#include <utility>
 
 #include "concepts.hpp"
 #include "range_traits.hpp"
@@ -18,7 +22,7 @@ namespace static_ranges {
     */
     template<typename Range>
         requires(range_nocvref<Range>::value == 2)
-    auto to_pair(Range && r)
+    constexpr auto to_pair(Range && r)
     {
         static_assert(
             static_ranges::range<std::remove_cvref_t<Range>>,
@@ -40,7 +44,7 @@ namespace static_ranges {
         * Helper function used by static_ranges::to_tuple()
         */
         template<typename Range>
-        static auto call(Range && r) {
+        static constexpr auto call(Range && r) {
             return std::make_tuple( 
                 (static_ranges::element<Is>(std::forward<Range>(r)))... );
         }
@@ -63,7 +67,7 @@ namespace static_ranges {
     */
     template<typename Range>
         requires static_ranges::range<Range>
-    decltype(auto) to_tuple(Range && r)
+    constexpr decltype(auto) to_tuple(Range && r)
     {
         return to_tuple_impl<make_sequence<Range>>::call(
             std::forward<Range>(r));
@@ -111,7 +115,7 @@ namespace static_ranges {
         */
         template<typename Range>
             requires range<std::remove_cvref_t<Range>>
-        static std::array
+        static constexpr std::array
         <
             std::remove_cvref_t<ArrayType>,
             range_nocvref<Range>::value
@@ -146,11 +150,127 @@ namespace static_ranges {
     */
     template<typename ArrayType, typename Range>
         requires static_ranges::range<std::remove_cvref_t<Range>>
-    auto to_array(Range && r) {
+    constexpr auto to_array(Range && r) {
        return to_array_impl<ArrayType, make_sequence<Range>>::call_to(
            std::forward<Range>(r));
     }
 
+
+
+    template<typename Target, typename Indices>
+    struct to_impl;
+
+    template<typename Target, std::size_t ... Is>
+    struct to_impl<Target, std::index_sequence<Is ...>>
+    {
+        /*
+        * Target is initialized with parentheses if it has a matching
+        * constructor (std::tuple, std::pair, ...), with braces otherwise
+        * (std::array, aggregates).
+        */
+        template<typename Range>
+        static constexpr bool parenthesized = std::is_constructible_v<
+            Target, decltype(static_ranges::element<Is>(std::declval<Range>())) ...>;
+
+        template<typename Range>
+        static constexpr Target call(Range && r) {
+            if constexpr (parenthesized<Range>)
+                return Target(static_ranges::element<Is>(std::forward<Range>(r)) ...);
+            else
+                return Target{ static_ranges::element<Is>(std::forward<Range>(r)) ... };
+        }
+
+        template<typename Range>
+        static constexpr Target * construct(Range && r, Target * storage) {
+            if constexpr (parenthesized<Range>)
+                return std::construct_at(storage, static_ranges::element<Is>(std::forward<Range>(r)) ...);
+            else
+                return ::new (static_cast<void *>(storage)) Target{
+                    static_ranges::element<Is>(std::forward<Range>(r)) ... };
+        }
+
+        /*
+        * Target<E...> for the element types E of Range, when Target is a class template.
+        */
+        template<template<typename ...> typename Template, typename Range>
+        using deduced = Template<std::remove_cvref_t<
+            decltype(static_ranges::element<Is>(std::declval<Range>()))> ...>;
+    };
+
+
+    /*
+    * Returns a Target initialized directly from the elements of the static
+    * range r, i.e. Target(e0, e1, ...) or, if Target has no such constructor,
+    * Target{ e0, e1, ... }. The elements are moved if r is an rvalue.
+    *
+    * example:
+    *
+    * auto t = static_ranges::to<std::tuple<long, std::string>>(std::move(r));
+    * auto p = static_ranges::to<point>(static_views::iota<int, 2>()); // aggregate
+    */
+    template<typename Target, typename Range>
+        requires static_ranges::range<std::remove_cvref_t<Range>>
+    constexpr Target to(Range && r) {
+        return to_impl<Target, make_sequence<Range>>::call(std::forward<Range>(r));
+    }
+
+
+    /*
+    * Same as to<Target<E...>>(r), where E... are the element types of r
+    * without references and cv-qualifiers.
+    *
+    * example:
+    *
+    * auto t = static_ranges::to<std::tuple>(static_views::iota<int, 3>()); // std::tuple<int, int, int>
+    */
+    template<template<typename ...> typename Target, typename Range>
+        requires static_ranges::range<std::remove_cvref_t<Range>>
+    constexpr auto to(Range && r) {
+        using impl = to_impl<void, make_sequence<Range>>;
+        return static_ranges::to<typename impl::template deduced<Target, Range>>(std::forward<Range>(r));
+    }
+
+
+    /*
+    * Constructs a Target from the elements of the static range r, as
+    * to<Target>(r) does, directly in the uninitialized storage pointed to by
+    * storage, and returns a pointer to it. No temporary Target is created,
+    * and the elements are moved if r is an rvalue.
+    *
+    * example:
+    *
+    * auto * records = static_cast<record *>(::operator new(n * sizeof(record)));
+    * for (std::size_t i = 0; i < n; ++i)
+    *     static_ranges::construct_into(views[i], records + i);
+    *
+    * Target comes first, as in to<Target> and the memory resource overload.
+    */
+    template<typename Target, typename Range>
+        requires static_ranges::range<std::remove_cvref_t<Range>>
+    constexpr Target * construct_into(Range && r, Target * storage) {
+        return to_impl<Target, make_sequence<Range>>::construct(std::forward<Range>(r), storage);
+    }
+
+
+    /*
+    * Allocates storage for a Target from the memory resource (e.g. an arena
+    * such as std::pmr::monotonic_buffer_resource) and constructs it in place
+    * from the elements of r with construct_into. The storage is given back
+    * to the resource if the construction throws.
+    */
+    template<typename Target, typename Range>
+        requires static_ranges::range<std::remove_cvref_t<Range>>
+    Target * construct_into(Range && r, std::pmr::memory_resource & resource) {
+        void * storage = resource.allocate(sizeof(Target), alignof(Target));
+        try {
+            return static_ranges::construct_into(std::forward<Range>(r), static_cast<Target *>(storage));
+        }
+        catch (...) {
+            resource.deallocate(storage, sizeof(Target), alignof(Target));
+            throw;
+        }
+    }
+
 } // static_ranges namespace
 
 
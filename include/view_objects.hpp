@@ -2,6 +2,10 @@
 #define __VIEW_OBJECTS_HPP__
 
 #include <functional>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 
 #include "concepts.hpp"
 #include "std.hpp"
@@ -23,6 +27,9 @@ namespace static_ranges {
         * static_ranges::element<0>(r_view) -= 40; // r_view<0> would be 2
         * cout << static_ranges::element<0>(r); // r<0> would be 2 because of the reference wrapper.
         * 
+        * The constness of the range is kept: a view_obj<const Range> gives
+        * only const access to the elements, so it can be shared between
+        * threads reading the range.
         */
         template<typename Range>
             requires static_ranges::range<Range>
@@ -33,11 +40,46 @@ namespace static_ranges {
 
             constexpr explicit view_obj(Range & t) : m_data(t) {}
 
-            std::reference_wrapper<std::remove_cvref_t<Range>> m_data;
+            std::reference_wrapper<std::remove_reference_t<Range>> m_data;
             
         };
 
 
+        /*
+        * Used by static_views::all() to hold a static range given as an rvalue:
+        * the range is moved into the view (copied, if it is const), so the
+        * view never refers to a temporary that is already destroyed.
+        * Like std::ranges::owning_view it is move-only, so a view over it
+        * can be moved along a pipeline but never silently deep-copied.
+        * 
+        * example:
+        * 
+        * auto v = std::make_tuple(1, 2.5, std::string("Foo")) | static_views::transform(f);
+        * //decltype(v) -> transform_view_object<owning_view<std::tuple<int, double, std::string>>, F>
+        */
+        template<typename Range>
+            requires static_ranges::range<Range> && std::is_object_v<Range> && (!std::is_const_v<Range>)
+        struct owning_view
+            : public static_ranges::view_base
+        {
+        public:
+
+            constexpr explicit owning_view(Range && t)
+                : m_data(std::move(t)) {}
+
+            constexpr explicit owning_view(const Range & t)
+                : m_data(t) {}
+
+            owning_view(const owning_view &) = delete;
+            owning_view & operator = (const owning_view &) = delete;
+
+            constexpr owning_view(owning_view &&) = default;
+            constexpr owning_view & operator = (owning_view &&) = default;
+
+            Range m_data;
+        };
+
+
         /*
         * Used by static_views::iota<N. I>() and static_views::static_iota<N, I>()
         */
@@ -82,6 +124,206 @@ namespace static_ranges {
             View m_view;
             Func m_func;
         };
+
+
+        /*
+        * A static view object returned by static_views::zip. Its I-th element
+        * is a std::tuple of the I-th elements of all the zipped views, each
+        * held as returned by element<I> (i.e. by reference, if possible).
+        * 
+        * example:
+        * 
+        * auto view = static_views::zip(r1, r2);
+        * //decltype(view) -> zip_view_object<view_obj<R1>, view_obj<R2>>
+        */
+        template<typename ... Views>
+            requires (static_ranges::view<Views> && ...)
+        struct zip_view_object
+            : public static_ranges::view_base
+        {
+        public:
+
+            constexpr explicit zip_view_object(Views && ... views)
+                : m_views(std::forward<Views>(views) ...)
+            {}
+
+            std::tuple<Views ...> m_views;
+        };
+
+
+        /*
+        * A static view object returned by static_views::zip_transform. Its
+        * I-th element is f(e1I, e2I, ...) for the I-th elements of all the
+        * zipped views, evaluated lazily when accessed.
+        */
+        template<typename Func, typename ... Views>
+            requires (static_ranges::view<Views> && ...)
+        struct zip_transform_view_object
+            : public static_ranges::view_base
+        {
+        public:
+
+            constexpr explicit zip_transform_view_object(Func && func, Views && ... views)
+                : m_func(std::forward<Func>(func)),
+                  m_views(std::forward<Views>(views) ...)
+            {}
+
+            Func m_func;
+            std::tuple<Views ...> m_views;
+        };
+
+
+        /*
+        * A static view object returned by static_views::concat. Its elements
+        * are the elements of the first view, followed by those of the second
+        * one, and so on, each returned as element<I> of its view returns it.
+        * 
+        * example:
+        * 
+        * auto view = static_views::concat(header, payload, trailer);
+        * //decltype(view) -> concat_view_object<view_obj<H>, view_obj<P>, view_obj<T>>
+        */
+        template<typename ... Views>
+            requires (static_ranges::view<Views> && ...)
+        struct concat_view_object
+            : public static_ranges::view_base
+        {
+        public:
+
+            constexpr explicit concat_view_object(Views && ... views)
+                : m_views(std::forward<Views>(views) ...)
+            {}
+
+            std::tuple<Views ...> m_views;
+        };
+
+
+        /*
+        * A static view object returned by static_views::enumerate. Its I-th
+        * element is a std::tuple of std::integral_constant<std::size_t, I>
+        * and the I-th element of the view.
+        */
+        template<typename View>
+            requires static_ranges::view<View>
+        struct enumerate_view_object
+            : public static_ranges::view_base
+        {
+        public:
+
+            constexpr explicit enumerate_view_object(View && view)
+                : m_view(std::forward<View>(view))
+            {}
+
+            View m_view;
+        };
+
+
+        /*
+        * A static view object returned by static_views::filter_types. Indices
+        * is the std::index_sequence of the elements of the view that passed
+        * the filter; the K-th element of this view is the element of the
+        * underlying view at the K-th of those indices.
+        */
+        template<typename View, typename Indices>
+            requires static_ranges::view<View>
+        struct filter_view_object
+            : public static_ranges::view_base
+        {
+        public:
+
+            constexpr explicit filter_view_object(View && view)
+                : m_view(std::forward<View>(view))
+            {}
+
+            View m_view;
+        };
+
+
+        /*
+        * The cache of a cache_view_object over View: a std::tuple holding for
+        * every element an empty std::optional of its type (without reference
+        * and cv-qualifiers).
+        */
+        template<typename View, typename Indices = make_sequence<View>>
+        struct cache_slots;
+
+        template<typename View, std::size_t ... I>
+        struct cache_slots<View, std::index_sequence<I ...>>
+        {
+            using type = std::tuple<std::optional<std::remove_cvref_t<
+                decltype(static_ranges::element<I>(std::declval<View &>()))>> ...>;
+        };
+
+
+        /*
+        * A static view object returned when views::cache is applied to a
+        * static range. The I-th element of the view is evaluated once, on the
+        * first access, and kept in the I-th slot of m_cache; every access
+        * returns a reference to the kept value. The cache is filled by const
+        * accesses too, so a cache view is not thread-safe.
+        * 
+        * example:
+        * 
+        * auto view = blobs | static_views::transform(parse) | static_views::cache;
+        * //decltype(view) -> cache_view_object<transform_view_object<view_obj<Blobs>, Parse>>
+        */
+        template<typename View>
+            requires static_ranges::view<View>
+        struct cache_view_object
+            : public static_ranges::view_base
+        {
+        public:
+
+            constexpr explicit cache_view_object(View && view)
+                : m_view(std::forward<View>(view))
+            {}
+
+            View m_view;
+            mutable typename cache_slots<View>::type m_cache;
+        };
+
+
+        template<typename T>
+        struct is_transform_view_object : std::false_type
+        {};
+
+        template<typename View, typename Func>
+        struct is_transform_view_object<transform_view_object<View, Func>> : std::true_type
+        {};
+
+
+        template<typename T>
+        struct is_filter_view_object : std::false_type
+        {};
+
+        template<typename View, typename Indices>
+        struct is_filter_view_object<filter_view_object<View, Indices>> : std::true_type
+        {};
+
+
+        /*
+        * Functor applying First and then Second to its argument. Used to fuse
+        * chained transformations into a single transform_view_object.
+        * The result is exactly what Second returns.
+        */
+        template<typename First, typename Second>
+        struct composition
+        {
+        public:
+
+            template<typename T>
+            constexpr decltype(auto) operator()(T && e) {
+                return m_second(m_first(std::forward<T>(e)));
+            }
+
+            template<typename T>
+            constexpr decltype(auto) operator()(T && e) const {
+                return m_second(m_first(std::forward<T>(e)));
+            }
+
+            First m_first;
+            Second m_second;
+        };
         
     } // views namespace
 
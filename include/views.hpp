@@ -1,6 +1,7 @@
 #ifndef __VIEWS_HPP__
 #define __VIEWS_HPP__
 
+#include <array>
 #include <functional>
 #include <type_traits>
 
@@ -23,10 +24,13 @@ namespace static_ranges {
     * Given a transform_view_object struct, get the ith element lazily.
     * If multiple transformations were chained together, apply all the
     * corresponding transformations to the ith element and return it.
+    * The result is exactly what the outermost functor returns, so a functor
+    * returning a reference (e.g. a projection to a member) yields that
+    * reference instead of a copy.
     */
     template<std::size_t I, typename View>
         requires std::is_base_of_v<static_views::transformable, std::remove_cvref_t<View>>
-    constexpr auto get_lazily(View && v) {
+    constexpr decltype(auto) get_lazily(View && v) {
         return std::forward<View>(v).m_func(get_lazily<I>(std::forward<View>(v).m_view));
     }
 
@@ -36,7 +40,7 @@ namespace static_ranges {
     */
     template<std::size_t I, typename View>
         requires (!std::is_base_of_v<static_views::transformable, std::remove_cvref_t<View>>)
-    constexpr auto get_lazily(View && v) {
+    constexpr decltype(auto) get_lazily(View && v) {
         return static_ranges::element<I>(std::forward<View>(v));
     }
 
@@ -71,15 +75,387 @@ namespace static_ranges {
     };
 
 
+    template<typename ... Views>
+    using zip_view_object = static_views::zip_view_object<Views ...>;
+
+    template<typename Func, typename ... Views>
+    using zip_transform_view_object = static_views::zip_transform_view_object<Func, Views ...>;
+
+    template<typename View>
+    using enumerate_view_object = static_views::enumerate_view_object<View>;
+
+    template<typename ... Views>
+    using concat_view_object = static_views::concat_view_object<Views ...>;
+
+    template<typename View>
+    using cache_view_object = static_views::cache_view_object<View>;
+
+
+    template<typename Indices>
+    struct zip_impl;
+
+    /*
+    * J... are the indices of the zipped views in the std::tuple holding them.
+    * Views is that std::tuple, possibly const and/or an rvalue.
+    */
+    template<std::size_t ... J>
+    struct zip_impl<std::index_sequence<J ...>>
+    {
+        template<std::size_t I, typename Views>
+        static constexpr auto element(Views && views) {
+            return std::tuple<decltype(static_ranges::element<I>(std::get<J>(std::forward<Views>(views)))) ...>(
+                static_ranges::element<I>(std::get<J>(std::forward<Views>(views))) ...);
+        }
+
+        template<std::size_t I, typename Func, typename Views>
+        static constexpr decltype(auto) invoke(Func && f, Views && views) {
+            return std::forward<Func>(f)(
+                static_ranges::element<I>(std::get<J>(std::forward<Views>(views))) ...);
+        }
+    };
+
+
+    /**
+    * Partial specialization for zip_view_object. The I-th element is a
+    * std::tuple holding what element<I> returns for each zipped view, so
+    * elements returned by reference are not copied.
+    */
+    template<typename View, typename ... Views>
+    struct range_traits<zip_view_object<View, Views ...>>
+        : std::integral_constant<std::size_t, range_nocvref<View>::value>
+    {
+        using impl = zip_impl<std::index_sequence_for<View, Views ...>>;
+
+        template<std::size_t I>
+        static constexpr auto get(zip_view_object<View, Views ...> && z)
+        {
+            return impl::template element<I>(std::move(z).m_views);
+        }
+
+        template<std::size_t I>
+        static constexpr auto get(zip_view_object<View, Views ...> & z)
+        {
+            return impl::template element<I>(z.m_views);
+        }
+
+        template<std::size_t I>
+        static constexpr auto get(const zip_view_object<View, Views ...> & z)
+        {
+            return impl::template element<I>(z.m_views);
+        }
+    };
+
+
+    /**
+    * Partial specialization for zip_transform_view_object. The I-th element
+    * is exactly what f(e1I, e2I, ...) returns, evaluated when accessed.
+    */
+    template<typename Func, typename View, typename ... Views>
+    struct range_traits<zip_transform_view_object<Func, View, Views ...>>
+        : std::integral_constant<std::size_t, range_nocvref<View>::value>
+    {
+        using impl = zip_impl<std::index_sequence_for<View, Views ...>>;
+
+        template<std::size_t I>
+        static constexpr decltype(auto) get(zip_transform_view_object<Func, View, Views ...> && z)
+        {
+            return impl::template invoke<I>(std::move(z).m_func, std::move(z).m_views);
+        }
+
+        template<std::size_t I>
+        static constexpr decltype(auto) get(zip_transform_view_object<Func, View, Views ...> & z)
+        {
+            return impl::template invoke<I>(z.m_func, z.m_views);
+        }
+
+        template<std::size_t I>
+        static constexpr decltype(auto) get(const zip_transform_view_object<Func, View, Views ...> & z)
+        {
+            return impl::template invoke<I>(z.m_func, z.m_views);
+        }
+    };
+
+
+    /*
+    * The position of every element of the concatenation of static ranges of
+    * sizes N...: source[I] is the index of the range holding the I-th
+    * element and local[I] its index in that range.
+    */
+    template<std::size_t ... N>
+    struct concat_indices
+    {
+        static constexpr std::size_t size = (N + ... + 0);
+
+        static constexpr std::array<std::size_t, sizeof...(N)> sizes = { N ... };
+
+        static constexpr std::array<std::size_t, size> source = [] {
+            std::array<std::size_t, size> a{};
+            std::size_t i = 0;
+            for (std::size_t j = 0; j < sizes.size(); ++j)
+                for (std::size_t k = 0; k < sizes[j]; ++k)
+                    a[i++] = j;
+            return a;
+        }();
+
+        static constexpr std::array<std::size_t, size> local = [] {
+            std::array<std::size_t, size> a{};
+            std::size_t i = 0;
+            for (std::size_t j = 0; j < sizes.size(); ++j)
+                for (std::size_t k = 0; k < sizes[j]; ++k)
+                    a[i++] = k;
+            return a;
+        }();
+    };
+
+
+    /**
+    * Partial specialization for concat_view_object. The I-th element is
+    * element<local[I]> of the view source[I], so nothing is copied.
+    */
+    template<typename ... Views>
+    struct range_traits<concat_view_object<Views ...>>
+        : std::integral_constant<std::size_t, concat_indices<range_nocvref<Views>::value ...>::size>
+    {
+        using indices = concat_indices<range_nocvref<Views>::value ...>;
+
+        template<std::size_t I>
+        static constexpr decltype(auto) get(concat_view_object<Views ...> && v)
+        {
+            return static_ranges::element<indices::local[I]>(
+                std::get<indices::source[I]>(std::move(v).m_views));
+        }
+
+        template<std::size_t I>
+        static constexpr decltype(auto) get(concat_view_object<Views ...> & v)
+        {
+            return static_ranges::element<indices::local[I]>(
+                std::get<indices::source[I]>(v.m_views));
+        }
+
+        template<std::size_t I>
+        static constexpr decltype(auto) get(const concat_view_object<Views ...> & v)
+        {
+            return static_ranges::element<indices::local[I]>(
+                std::get<indices::source[I]>(v.m_views));
+        }
+    };
+
+
+    /**
+    * Partial specialization for enumerate_view_object. The I-th element is
+    * a std::tuple of std::integral_constant<std::size_t, I> and what
+    * element<I> returns for the underlying view.
+    */
+    template<typename View>
+    struct range_traits<enumerate_view_object<View>>
+        : std::integral_constant<std::size_t, range_nocvref<View>::value>
+    {
+        template<std::size_t I, typename Enumerate>
+        static constexpr auto make(Enumerate && v)
+        {
+            using index = std::integral_constant<std::size_t, I>;
+            return std::tuple<index, decltype(static_ranges::element<I>(std::forward<Enumerate>(v).m_view))>(
+                index(), static_ranges::element<I>(std::forward<Enumerate>(v).m_view));
+        }
+
+        template<std::size_t I>
+        static constexpr auto get(enumerate_view_object<View> && v)
+        {
+            return make<I>(std::move(v));
+        }
+
+        template<std::size_t I>
+        static constexpr auto get(enumerate_view_object<View> & v)
+        {
+            return make<I>(v);
+        }
+
+        template<std::size_t I>
+        static constexpr auto get(const enumerate_view_object<View> & v)
+        {
+            return make<I>(v);
+        }
+    };
+
+
+    template<typename View, typename Indices>
+    using filter_view_object = static_views::filter_view_object<View, Indices>;
+
+
+    /*
+    * The indices I of the elements of Range for which
+    * Pred<std::remove_cvref_t<decltype(element<I>(r))>>::value is true,
+    * as a std::index_sequence. Computed by a constexpr loop, so the cost
+    * does not grow with recursion over the elements.
+    */
+    template<template<typename> typename Pred, typename Range, typename Indices = make_sequence<Range>>
+    struct filter_indices;
+
+    template<template<typename> typename Pred, typename Range, std::size_t ... I>
+    struct filter_indices<Pred, Range, std::index_sequence<I ...>>
+    {
+        static constexpr std::array<bool, sizeof...(I)> keep = {
+            static_cast<bool>(Pred<std::remove_cvref_t<
+                decltype(static_ranges::element<I>(std::declval<Range &>()))>>::value) ...
+        };
+
+        static constexpr std::size_t count = [] {
+            std::size_t n = 0;
+            for (bool k : keep)
+                n += k;
+            return n;
+        }();
+
+        static constexpr std::array<std::size_t, count> indices = [] {
+            std::array<std::size_t, count> a{};
+            std::size_t n = 0;
+            for (std::size_t i = 0; i < keep.size(); ++i)
+                if (keep[i])
+                    a[n++] = i;
+            return a;
+        }();
+
+        template<std::size_t ... K>
+        static auto make(std::index_sequence<K ...>) -> std::index_sequence<indices[K] ...>;
+
+        using type = decltype(make(std::make_index_sequence<count>()));
+    };
+
+
+    /**
+    * Partial specialization for cache_view_object. The I-th element is the
+    * value in the I-th slot of the cache, evaluated from the underlying view
+    * if the slot is empty.
+    */
+    template<typename View>
+    struct range_traits<cache_view_object<View>>
+        : std::integral_constant<std::size_t, range_nocvref<View>::value>
+    {
+        template<std::size_t I, typename Cache>
+        static constexpr auto & slot(Cache & v)
+        {
+            auto & s = std::get<I>(v.m_cache);
+            if (!s)
+                s.emplace(static_ranges::element<I>(v.m_view));
+            return *s;
+        }
+
+        template<std::size_t I>
+        static constexpr auto && get(cache_view_object<View> && v)
+        {
+            return std::move(slot<I>(v));
+        }
+
+        template<std::size_t I>
+        static constexpr auto & get(cache_view_object<View> & v)
+        {
+            return slot<I>(v);
+        }
+
+        template<std::size_t I>
+        static constexpr const auto & get(const cache_view_object<View> & v)
+        {
+            return slot<I>(v);
+        }
+    };
+
+
+    /*
+    * The indices of the elements of a static range of size N kept by Remap,
+    * in their new order, as a std::index_sequence: the K-th one is
+    * Remap::index(K, N), for K < Remap::size(N).
+    */
+    template<typename Remap, std::size_t N>
+    struct remap_indices
+    {
+        static constexpr std::size_t count = Remap::size(N);
+
+        static constexpr std::array<std::size_t, count> indices = [] {
+            std::array<std::size_t, count> a{};
+            for (std::size_t k = 0; k < count; ++k)
+                a[k] = Remap::index(k, N);
+            return a;
+        }();
+
+        template<std::size_t ... K>
+        static auto make(std::index_sequence<K ...>) -> std::index_sequence<indices[K] ...>;
+
+        using type = decltype(make(std::make_index_sequence<count>()));
+    };
+
+
+    /*
+    * The index remappings of views::take, views::drop, views::stride and views::reverse.
+    */
+    template<std::size_t Count>
+    struct take_remap
+    {
+        static constexpr std::size_t size(std::size_t n) { return Count < n ? Count : n; }
+        static constexpr std::size_t index(std::size_t k, std::size_t) { return k; }
+    };
+
+    template<std::size_t Count>
+    struct drop_remap
+    {
+        static constexpr std::size_t size(std::size_t n) { return Count < n ? n - Count : 0; }
+        static constexpr std::size_t index(std::size_t k, std::size_t) { return Count + k; }
+    };
+
+    template<std::size_t Step>
+        requires (Step != 0)
+    struct stride_remap
+    {
+        static constexpr std::size_t size(std::size_t n) { return (n + Step - 1) / Step; }
+        static constexpr std::size_t index(std::size_t k, std::size_t) { return k * Step; }
+    };
+
+    struct reverse_remap
+    {
+        static constexpr std::size_t size(std::size_t n) { return n; }
+        static constexpr std::size_t index(std::size_t k, std::size_t n) { return n - 1 - k; }
+    };
+
+
+    /**
+    * Partial specialization for filter_view_object. The K-th element is the
+    * element of the underlying view at the K-th surviving index I.
+    */
+    template<typename View, std::size_t ... I>
+    struct range_traits<filter_view_object<View, std::index_sequence<I ...>>>
+        : std::integral_constant<std::size_t, sizeof...(I)>
+    {
+        static constexpr std::array<std::size_t, sizeof...(I)> indices = { I ... };
+
+        template<std::size_t K>
+        static constexpr decltype(auto) get(filter_view_object<View, std::index_sequence<I ...>> && v)
+        {
+            return static_ranges::element<indices[K]>(std::move(v).m_view);
+        }
+
+        template<std::size_t K>
+        static constexpr decltype(auto) get(filter_view_object<View, std::index_sequence<I ...>> & v)
+        {
+            return static_ranges::element<indices[K]>(v.m_view);
+        }
+
+        template<std::size_t K>
+        static constexpr decltype(auto) get(const filter_view_object<View, std::index_sequence<I ...>> & v)
+        {
+            return static_ranges::element<indices[K]>(v.m_view);
+        }
+    };
+
+
     namespace views {
 
         /*
-        * returns an rvalue identical to e, if e is a static view.
+        * returns an rvalue identical to e, if e is a static view, i.e. a copy
+        * of e if it is an lvalue, or else e moved.
         */
         template<typename View>
             requires static_ranges::view<std::remove_cvref_t<View>>
-        auto&& all(View && t) {
-            return std::move(t);
+        constexpr std::remove_cvref_t<View> all(View && t) {
+            return std::forward<View>(t);
         }
 
         /*
@@ -88,8 +464,19 @@ namespace static_ranges {
         */
         template<typename Range>
             requires range_but_not_view<std::remove_cvref_t<Range>>
-        decltype(auto) all(Range && t) {
-            return view_obj(std::forward<Range>(t));
+        constexpr auto all(Range & t) {
+            return view_obj(t);
+        }
+
+        /*
+        * returns a view object holding the static range given as an rvalue,
+        * moved into it, so views of temporaries do not dangle.
+        */
+        template<typename Range>
+            requires range_but_not_view<std::remove_cvref_t<Range>> &&
+                     (!std::is_lvalue_reference_v<Range>)
+        constexpr auto all(Range && t) {
+            return owning_view<std::remove_cv_t<Range>>(std::forward<Range>(t));
         }
 
 
@@ -159,12 +546,54 @@ namespace static_ranges {
             * Lazy evaluation is done, i.e. the eI element shall be retrieved and the
             * f(eI) expression shall be evaluated when the corresponding element of 
             * the returned static view is accessed.
+            * The functor is moved into the view if the closure owns it, and copied
+            * if it refers to the caller's lvalue (Func is F &).
             */
             template<typename Range>
-                requires static_ranges::range<std::remove_cvref_t<Range>>
-            auto operator()(Range && r) {
+                requires static_ranges::range<std::remove_cvref_t<Range>> &&
+                         (!is_transform_view_object<std::remove_cvref_t<Range>>::value)
+            constexpr auto operator()(Range && r) && {
+                return transform_view_object(
+                    all(std::forward<Range>(r)), std::remove_cvref_t<Func>(std::forward<Func>(m_func)));
+            }
+
+            /*
+            * Same as above for a closure object that is not an rvalue (e.g. a
+            * const closure shared by several pipelines): the functor is copied
+            * into the view, so the closure can be applied again.
+            */
+            template<typename Range>
+                requires static_ranges::range<std::remove_cvref_t<Range>> &&
+                         (!is_transform_view_object<std::remove_cvref_t<Range>>::value)
+            constexpr auto operator()(Range && r) const & {
                 return transform_view_object(
-                    all(std::forward<Range>(r)), std::move(m_func));
+                    all(std::forward<Range>(r)), std::remove_cvref_t<Func>(m_func));
+            }
+
+            /*
+            * Applied to a transform view, the functor is composed with the functor
+            * of that view instead of wrapping the view once more, so chained
+            * transformations always give a single flat view object.
+            * 
+            * example:
+            * 
+            * auto view = iota<int, 6>() | transform(f) | transform(g);
+            * //decltype(view) -> transform_view_object<iota_object, composition<F, G>>
+            */
+            template<typename View, typename F>
+            constexpr auto operator()(transform_view_object<View, F> v) && {
+                using composed = composition<F, std::remove_cvref_t<Func>>;
+                return transform_view_object<View, composed>(
+                    std::move(v.m_view),
+                    composed{ std::forward<F>(v.m_func), std::forward<Func>(m_func) });
+            }
+
+            template<typename View, typename F>
+            constexpr auto operator()(transform_view_object<View, F> v) const & {
+                using composed = composition<F, std::remove_cvref_t<Func>>;
+                return transform_view_object<View, composed>(
+                    std::move(v.m_view),
+                    composed{ std::forward<F>(v.m_func), m_func });
             }
 
             Func m_func;
@@ -187,6 +616,23 @@ namespace static_ranges {
         }
 
 
+        /*
+        * Composes two range adaptor closure objects into one, so that
+        * r | (c1 | c2) is equivalent to r | c1 | c2.
+        * 
+        * example:
+        * auto closure = transform([](auto && v) { return v + 1; })
+        *              | transform([](auto && v) { return v * 2; });
+        * //decltype(closure) -> range_adaptor_closure<composition<F, G>>
+        */
+        template<typename First, typename Second>
+        constexpr auto operator | (range_adaptor_closure<First> c1, range_adaptor_closure<Second> c2) {
+            using composed = composition<std::remove_cvref_t<First>, std::remove_cvref_t<Second>>;
+            return range_adaptor_closure<composed>(
+                composed{ std::forward<First>(c1.m_func), std::forward<Second>(c2.m_func) });
+        }
+
+
         /*
         * Given a functor as an input, return a view adaptive
         * closure object that could then be applied to transform
@@ -220,6 +666,294 @@ namespace static_ranges {
         }
 
 
+        /*
+        * Returns a static view whose I-th element is a std::tuple of the I-th
+        * elements of all the given static ranges, which shall have the same
+        * size. Elements are held by reference whenever element<I> returns a
+        * reference, so writing through the tuple modifies the ranges.
+        * 
+        * example:
+        * 
+        * std::tuple<int, double> r1 = { 1, 2.5 };
+        * std::array<std::string, 2> r2 = { "Foo", "Bar" };
+        * auto view = static_views::zip(r1, r2);
+        * std::get<1>(static_ranges::element<0>(view)) += "Baz"; // modifies r2[0]
+        */
+        template<typename Range, typename ... Ranges>
+            requires static_ranges::range<std::remove_cvref_t<Range>> &&
+                     (static_ranges::range<std::remove_cvref_t<Ranges>> && ...) &&
+                     ((range_nocvref<Ranges>::value == range_nocvref<Range>::value) && ...)
+        constexpr auto zip(Range && r, Ranges && ... rs) {
+            return zip_view_object(
+                all(std::forward<Range>(r)), all(std::forward<Ranges>(rs)) ...);
+        }
+
+
+        /*
+        * Returns a static view whose I-th element is f(e1I, e2I, ...), where
+        * eKI is the I-th element of the K-th static range. The ranges shall
+        * have the same size. f is evaluated lazily, when an element is accessed,
+        * and its result is returned as is.
+        * 
+        * example:
+        * 
+        * auto sums = static_views::zip_transform(std::plus<>(), r1, r2);
+        */
+        template<typename Func, typename Range, typename ... Ranges>
+            requires static_ranges::range<std::remove_cvref_t<Range>> &&
+                     (static_ranges::range<std::remove_cvref_t<Ranges>> && ...) &&
+                     ((range_nocvref<Ranges>::value == range_nocvref<Range>::value) && ...)
+        constexpr auto zip_transform(Func && f, Range && r, Ranges && ... rs) {
+            return zip_transform_view_object(
+                std::decay_t<Func>(std::forward<Func>(f)),
+                all(std::forward<Range>(r)), all(std::forward<Ranges>(rs)) ...);
+        }
+
+
+        /*
+        * Returns a static view of the elements of r followed by those of
+        * each of rs..., without copying any of them: the source range and the
+        * index in it of every element are computed at compile time, and the
+        * ranges that are not views are held by reference.
+        * 
+        * example:
+        * 
+        * std::tuple<std::uint16_t, std::uint16_t> header = { 1, 42 };
+        * std::tuple<double, std::string> body = { 3.14, "Foo" };
+        * std::array<std::uint8_t, 2> trailer = { 0xff, 0xfe };
+        * auto record = static_views::concat(header, body, trailer);
+        * //size_v<decltype(record)> -> 6
+        * static_ranges::element<3>(record) += "Bar"; // modifies std::get<1>(body)
+        */
+        template<typename Range, typename ... Ranges>
+            requires static_ranges::range<std::remove_cvref_t<Range>> &&
+                     (static_ranges::range<std::remove_cvref_t<Ranges>> && ...)
+        constexpr auto concat(Range && r, Ranges && ... rs) {
+            return concat_view_object(all(std::forward<Range>(r)), all(std::forward<Ranges>(rs)) ...);
+        }
+
+
+        /*
+        * Returns a static view whose I-th element is a std::tuple of
+        * std::integral_constant<std::size_t, I> and the I-th element of the
+        * static range, so the index is available as a constant expression.
+        * 
+        * example:
+        * 
+        * static_ranges::for_each(static_views::enumerate(r), [](auto && p) {
+        *     auto && [index, e] = p;
+        *     std::get<decltype(index)::value>(other) = e;
+        * });
+        */
+        template<typename Range>
+            requires static_ranges::range<std::remove_cvref_t<Range>>
+        constexpr auto enumerate(Range && r) {
+            return enumerate_view_object(all(std::forward<Range>(r)));
+        }
+
+
+        /*
+        * Range adaptor closure object of views::filter_types.
+        */
+        template<template<typename> typename Pred>
+        struct filter_types_closure {
+
+            template<typename Range>
+                requires static_ranges::range<std::remove_cvref_t<Range>>
+            constexpr auto operator()(Range && r) const {
+                using view = std::remove_cvref_t<decltype(all(std::forward<Range>(r)))>;
+                return filter_view_object<view, typename filter_indices<Pred, view>::type>(
+                    all(std::forward<Range>(r)));
+            }
+        };
+
+
+        /*
+        * Range adaptor closure object which, applied to a static range, gives
+        * a static view of only those elements eI for which
+        * Pred<std::remove_cvref_t<decltype(eI)>>::value is true. The surviving
+        * indices are computed at compile time and the view stores nothing but
+        * the view of the range, so code is instantiated for the kept elements only.
+        * 
+        * example:
+        * 
+        * std::tuple<int, std::string, double> t = { 42, "Foo", 3.14 };
+        * auto numbers = t | static_views::filter_types<std::is_arithmetic>;
+        * //size_v<decltype(numbers)> -> 2
+        * static_ranges::for_each(numbers, [](auto & v) { v *= 2; }); // modifies 42 and 3.14
+        */
+        template<template<typename> typename Pred>
+        inline constexpr filter_types_closure<Pred> filter_types{};
+
+
+        /*
+        * Range adaptor closure object of views::take, views::drop,
+        * views::stride and views::reverse: a filter_view_object keeping the
+        * elements given by Remap.
+        */
+        template<typename Remap>
+        struct remap_closure {
+
+            template<typename Range>
+                requires static_ranges::range<std::remove_cvref_t<Range>> &&
+                         (!is_filter_view_object<std::remove_cvref_t<Range>>::value)
+            constexpr auto operator()(Range && r) const {
+                using view = std::remove_cvref_t<decltype(all(std::forward<Range>(r)))>;
+                return filter_view_object<view, typename remap_indices<Remap, range_nocvref<view>::value>::type>(
+                    all(std::forward<Range>(r)));
+            }
+
+            /*
+            * Applied to a view that already selects indices I... of its
+            * underlying view, the remapping is composed with them instead of
+            * wrapping the view once more, so chained slices give a single
+            * flat view object.
+            *
+            * example:
+            *
+            * auto view = r | drop<1> | stride<2> | reverse;
+            * //decltype(view) -> filter_view_object<view_obj<R>, std::index_sequence<...>>
+            */
+            template<typename View, std::size_t ... I>
+            constexpr auto operator()(filter_view_object<View, std::index_sequence<I ...>> v) const {
+                return filter_view_object<View, decltype(compose<I ...>(
+                    typename remap_indices<Remap, sizeof...(I)>::type()))>(std::move(v.m_view));
+            }
+
+        private:
+
+            template<std::size_t ... I, std::size_t ... K>
+            static auto compose(std::index_sequence<K ...>) -> std::index_sequence<
+                std::array<std::size_t, sizeof...(I)>{ I ... }[K] ...>;
+        };
+
+
+        /*
+        * Range adaptor closure object which, applied to a static range, gives
+        * a static view of its first Count elements (all of them, if the range
+        * is smaller). Like the other slicing views below, it stores only the
+        * view of the range and its indices are resolved at compile time, so
+        * accessing an element costs what element<I> on the range costs.
+        *
+        * example:
+        *
+        * std::tuple<int, std::string, double> t = { 42, "Foo", 3.14 };
+        * auto first = t | static_views::take<2>; // 42, "Foo"
+        */
+        template<std::size_t Count>
+        inline constexpr remap_closure<take_remap<Count>> take{};
+
+
+        /*
+        * Range adaptor closure object which, applied to a static range, gives
+        * a static view of its elements but the first Count ones (none, if the
+        * range is not larger).
+        *
+        * example:
+        *
+        * auto rest = t | static_views::drop<1>; // "Foo", 3.14
+        */
+        template<std::size_t Count>
+        inline constexpr remap_closure<drop_remap<Count>> drop{};
+
+
+        /*
+        * Range adaptor closure object which, applied to a static range, gives
+        * a static view of every Step-th element, starting with the first one.
+        * Step must not be 0.
+        *
+        * example:
+        *
+        * auto even = t | static_views::stride<2>; // 42, 3.14
+        */
+        template<std::size_t Step>
+        inline constexpr remap_closure<stride_remap<Step>> stride{};
+
+
+        /*
+        * Range adaptor closure object which, applied to a static range, gives
+        * a static view of its elements in reverse order.
+        *
+        * example:
+        *
+        * auto reversed = t | static_views::reverse; // 3.14, "Foo", 42
+        */
+        inline constexpr remap_closure<reverse_remap> reverse{};
+
+
+        /*
+        * Range adaptor closure object of views::cache.
+        */
+        struct cache_closure {
+
+            template<typename Range>
+                requires static_ranges::range<std::remove_cvref_t<Range>>
+            constexpr auto operator()(Range && r) const {
+                return cache_view_object(all(std::forward<Range>(r)));
+            }
+        };
+
+
+        /*
+        * Range adaptor closure object which, applied to a static range, gives
+        * a static view evaluating each element of the range at most once: the
+        * first access to the I-th element stores a copy of it in a slot of the
+        * view (a std::optional of the element type) and every access returns a
+        * reference to that copy. Placed after transform, it runs an expensive
+        * functor once per element however many times the view is read.
+        * 
+        * example:
+        * 
+        * auto records = blobs | static_views::transform(decompress) | static_views::cache;
+        * use(static_ranges::element<0>(records)); // decompresses the first blob
+        * use(static_ranges::element<0>(records)); // reads the cached result
+        */
+        inline constexpr cache_closure cache{};
+
+
+        /*
+        * Functor used by views::project. Invokes the projection on an element
+        * and returns the result of the invocation as is if it is an lvalue
+        * reference into the element. An rvalue reference, i.e. the projection
+        * of an rvalue element, is returned by value instead: the element may be
+        * a temporary, e.g. returned by value from a transform view, which the
+        * reference would outlive. Proj may be a pointer to member.
+        */
+        template<typename Proj>
+        struct projection {
+
+            template<typename T>
+            constexpr decltype(auto) operator()(T && e) const {
+                using result_type = std::invoke_result_t<const Proj &, T>;
+                static_assert(std::is_reference_v<result_type>,
+                    "A projection must return a reference into the element, use transform for computed values");
+                if constexpr (std::is_lvalue_reference_v<result_type>)
+                    return std::invoke(m_proj, std::forward<T>(e));
+                else
+                    return std::remove_cvref_t<result_type>(std::invoke(m_proj, std::forward<T>(e)));
+            }
+
+            Proj m_proj;
+        };
+
+
+        /*
+        * Returns a range adaptor closure object which, applied to a static range,
+        * gives a static view whose I-th element is a reference to the part of the
+        * I-th element of the range selected by the projection. No element is copied.
+        * 
+        * example:
+        * 
+        * std::tuple<person, person> t = { { "Foo", 42 }, { "Bar", 24 } };
+        * auto names = t | project(&person::name);
+        * static_ranges::element<0>(names) += "_suffix"; // modifies std::get<0>(t).name
+        */
+        template<typename Proj>
+        constexpr auto project(Proj && p) {
+            return transform(projection<std::decay_t<Proj>>{ std::forward<Proj>(p) });
+        }
+
+
     } // views namespace
 
 }
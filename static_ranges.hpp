@@ -7,5 +7,12 @@
 #include "include/helpers.hpp"
 #include "include/views.hpp"
 #include "include/std.hpp"
+#include "include/soa.hpp"
+#include "include/fold.hpp"
+#include "include/hash.hpp"
+#include "include/compare.hpp"
+#include "include/packed_tuple.hpp"
+#include "include/pipeline.hpp"
+#include "include/serialize.hpp"
 
 #endif //__STATIC_RANGES_HPP__
@@ -0,0 +1,119 @@
+/*
+* async test: runs tasks, async_for_each and async_transform on the
+* single-threaded executor and checks that the awaitables of a group are
+* interleaved, that their results land in the destination range, that
+* exceptions are rethrown once the group completed, and that the (immovable)
+* awaitables of the async algorithms can be run by the executor directly.
+*/
+
+#include "static_ranges.hpp"
+#include "include/async.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+
+namespace {
+
+    using static_ranges::task;
+    using executor_type = static_ranges::execution::single_thread_executor;
+
+
+    static_assert(!std::is_move_constructible_v<decltype(static_ranges::async_for_each(
+        std::declval<std::array<int, 2> &>(), [](int) -> task<> { co_return; }))>);
+
+    static_assert(std::is_same_v<static_ranges::await_result_t<task<int>>, int>);
+
+
+    task<int> twice(executor_type & executor, int x) {
+        co_await executor.schedule();
+        co_return 2 * x;
+    }
+
+    task<int> chained(executor_type & executor, int x) {
+        int y = co_await twice(executor, x);
+        co_return co_await twice(executor, y) + 1;
+    }
+
+    task<std::string> suffixed(executor_type & executor, std::string s) {
+        co_await executor.sleep_for(std::chrono::milliseconds(1));
+        co_return s + "Bar";
+    }
+
+    task<> step_twice(executor_type & executor, std::string & log, char c) {
+        log += c;
+        co_await executor.schedule();
+        log += c;
+    }
+
+    task<> failing(executor_type & executor, int i) {
+        co_await executor.schedule();
+        if (i != 0)
+            throw std::runtime_error(std::to_string(i));
+    }
+
+    struct ready_awaitable {
+        bool await_ready() const noexcept { return true; }
+        void await_suspend(std::coroutine_handle<>) const noexcept {}
+        int await_resume() const noexcept { return 7; }
+    };
+
+
+    bool check(bool ok, const char * what) {
+        if (!ok)
+            std::fprintf(stderr, "async: %s failed\n", what);
+        return ok;
+    }
+
+} // anonymous namespace
+
+
+int main()
+{
+    executor_type executor;
+    bool ok = true;
+
+    ok &= check(executor.run(chained(executor, 5)) == 21, "chained tasks");
+
+    std::string log;
+    std::array<char, 3> names = { 'a', 'b', 'c' };
+    executor.run(static_ranges::async_for_each(names, [&](char c) { return step_twice(executor, log, c); }));
+    ok &= check(log == "abcabc", "interleaved async_for_each");
+
+    std::tuple<int, std::string, int> in = { 1, "Foo", 0 };
+    std::tuple<int, std::string, int> out;
+    executor.run(static_ranges::async_transform(in, out, [&](auto & e) {
+        if constexpr (std::is_same_v<std::remove_cvref_t<decltype(e)>, std::string>)
+            return suffixed(executor, e);
+        else
+            return twice(executor, e);
+    }));
+    ok &= check(out == std::tuple<int, std::string, int>{ 2, "FooBar", 0 }, "async_transform");
+
+    std::array<int, 2> ready{};
+    executor.run(static_ranges::async_transform(std::array<int, 2>{}, ready, [](int) { return ready_awaitable{}; }));
+    ok &= check(ready == std::array<int, 2>{ 7, 7 }, "synchronous awaitables");
+
+    executor.run(static_ranges::async_for_each(std::tuple<>{}, [](auto) { return ready_awaitable{}; }));
+
+    try {
+        executor.run(static_ranges::async_for_each(std::array<int, 3>{ 0, 1, 2 }, [&](int i) { return failing(executor, i); }));
+        ok &= check(false, "exception");
+    }
+    catch (const std::runtime_error & e) {
+        ok &= check(std::string(e.what()) == "1", "first exception by index");
+    }
+
+    try {
+        executor.run([]() -> task<> { co_await std::suspend_always{}; }());
+        ok &= check(false, "never completing awaitable");
+    }
+    catch (const std::logic_error &) {
+    }
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,76 @@
+/*
+* cache test: checks at run time that a cache view evaluates the functor of
+* the underlying transform view once per element, however often and through
+* whichever of a non-const and a const view the element is accessed, and that
+* the values returned stay the same. GCC 12 cannot evaluate a cache in a
+* constant expression, so this is not part of the constexpr test.
+*/
+
+#include "static_ranges.hpp"
+
+#include <array>
+#include <cstdio>
+#include <string>
+#include <tuple>
+#include <type_traits>
+
+namespace {
+
+    bool evaluates_once() {
+        std::tuple<int, long, std::string> r = { 1, 2, "Foo" };
+        std::array<int, 3> calls{};
+
+        auto counted = [&calls]<typename T>(const T & e) {
+            if constexpr (std::is_same_v<T, std::string>) {
+                ++calls[2];
+                return e + e;
+            }
+            else {
+                ++calls[sizeof(T) == sizeof(int) ? 0 : 1];
+                return e * 10;
+            }
+        };
+
+        auto v = r | static_views::transform(counted) | static_views::cache;
+        const auto & cv = v;
+
+        // nothing is evaluated before the first access
+        if (calls != std::array<int, 3>{ 0, 0, 0 })
+            return false;
+
+        bool same = true;
+        for (int pass = 0; pass < 3; ++pass) {
+            same &= static_ranges::element<0>(v) == 10 && static_ranges::element<0>(cv) == 10;
+            same &= static_ranges::element<1>(cv) == 20 && static_ranges::element<1>(v) == 20;
+        }
+        if (!same || calls != std::array<int, 3>{ 1, 1, 0 })
+            return false;
+
+        // the same slot is returned, not a fresh value
+        if (&static_ranges::element<2>(v) != &static_ranges::element<2>(cv))
+            return false;
+        same = static_ranges::element<2>(v) == "FooFoo" && static_ranges::element<2>(cv) == "FooFoo";
+
+        // the cache keeps the first value even if the source changes
+        std::get<0>(r) = 5;
+        same &= static_ranges::element<0>(v) == 10 && static_ranges::element<0>(cv) == 10;
+
+        return same && calls == std::array<int, 3>{ 1, 1, 1 };
+    }
+
+
+    bool check(bool ok, const char * what) {
+        if (!ok)
+            std::fprintf(stderr, "cache: %s failed\n", what);
+        return ok;
+    }
+
+} // anonymous namespace
+
+
+int main()
+{
+    bool ok = true;
+    ok &= check(evaluates_once(), "one evaluation per element");
+    return ok ? 0 : 1;
+}
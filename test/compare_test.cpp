@@ -0,0 +1,158 @@
+/*
+* compare test: the constexpr test only runs the constant-evaluation loop of
+* the contiguous comparisons, so this one checks at run time, on data the
+* compiler cannot see, that the memcmp paths of equal, compare_three_way and
+* lexicographical_compare agree with the element-wise comparison, including
+* arrays that differ only in their last element, ranges of different sizes
+* and element types that fall back to the element-wise comparison.
+*/
+
+#include "static_ranges.hpp"
+
+#include <algorithm>
+#include <array>
+#include <compare>
+#include <cstdio>
+#include <random>
+#include <tuple>
+
+namespace {
+
+    constexpr std::size_t size = 37;
+
+    using ints = std::array<int, size>;
+    using bytes = std::array<unsigned char, size>;
+
+    static_assert(static_ranges::memcmp_comparable<ints, ints>);
+    static_assert(!static_ranges::memcmp_orderable<ints, ints>);
+    static_assert(static_ranges::memcmp_orderable<bytes, bytes>);
+    static_assert(!static_ranges::memcmp_comparable<std::array<double, 2>, std::array<double, 2>>);
+
+
+    std::mt19937 gen(42);
+
+    template<typename Array>
+    Array make_array() {
+        // a small value range, so random arrays often share long prefixes
+        std::uniform_int_distribution<int> dist(0, 3);
+        Array a;
+        for (auto & e : a)
+            e = static_cast<typename Array::value_type>(dist(gen) * 85);
+        return a;
+    }
+
+    // the element-wise results the memcmp paths must give
+    template<typename Array>
+    bool elementwise_equal(const Array & a, const Array & b) {
+        return static_ranges::compare_impl<make_sequence<Array>>::equal(a, b);
+    }
+
+    template<typename Array>
+    std::strong_ordering elementwise_three_way(const Array & a, const Array & b) {
+        return static_ranges::compare_impl<make_sequence<Array>>::three_way(a, b);
+    }
+
+
+    bool equal_ints() {
+        for (int run = 0; run < 1000; ++run) {
+            const ints a = make_array<ints>();
+            ints b = run % 2 ? a : make_array<ints>();
+            if (run % 3 == 0)
+                b[size - 1] ^= 1;
+            if (static_ranges::equal(a, b) != elementwise_equal(a, b) ||
+                static_ranges::equal(a, b) != (a == b))
+                return false;
+        }
+        return true;
+    }
+
+    bool ordered_bytes() {
+        for (int run = 0; run < 1000; ++run) {
+            const bytes a = make_array<bytes>();
+            bytes b = run % 2 ? a : make_array<bytes>();
+            if (run % 3 == 0)
+                b[size - 1] = static_cast<unsigned char>(255 - b[size - 1]);
+
+            const auto expected = elementwise_three_way(a, b);
+            if (static_ranges::compare_three_way(a, b) != expected ||
+                static_ranges::lexicographical_compare(a, b) != (expected < 0) ||
+                static_ranges::lexicographical_compare(a, b) !=
+                    std::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end()))
+                return false;
+        }
+        return true;
+    }
+
+    bool last_element() {
+        ints a = make_array<ints>();
+        ints b = a;
+        bytes c = make_array<bytes>();
+        bytes d = c;
+        if (!static_ranges::equal(a, b) || static_ranges::compare_three_way(c, d) != 0)
+            return false;
+
+        b[size - 1] += 1;
+        c[size - 1] = 0;
+        d[size - 1] = 200;
+        return !static_ranges::equal(a, b)
+            && static_ranges::compare_three_way(c, d) < 0
+            && static_ranges::compare_three_way(d, c) > 0
+            && static_ranges::lexicographical_compare(c, d)
+            && !static_ranges::lexicographical_compare(d, c);
+    }
+
+    bool different_sizes() {
+        const bytes a = make_array<bytes>();
+        std::array<unsigned char, size + 1> longer;
+        std::copy(a.begin(), a.end(), longer.begin());
+        longer[size] = 0;
+
+        std::array<unsigned char, size - 1> shorter;
+        std::copy(a.begin(), a.end() - 1, shorter.begin());
+
+        return !static_ranges::equal(a, longer)
+            && static_ranges::compare_three_way(a, longer) < 0
+            && static_ranges::compare_three_way(longer, a) > 0
+            && static_ranges::lexicographical_compare(a, longer)
+            && static_ranges::compare_three_way(shorter, a) < 0
+            && !static_ranges::lexicographical_compare(a, shorter);
+    }
+
+    // doubles are not memcmp comparable: -0.0 == 0.0 with different bytes
+    bool fallback() {
+        std::uniform_int_distribution<int> dist(1, 3);
+        std::array<double, 4> a = { 1.0, 0.0 * dist(gen), 2.5, -3.0 };
+        std::array<double, 4> b = a;
+        b[1] = -a[1];
+
+        const std::tuple<int, double> t1 = { static_cast<int>(a[0]), a[2] };
+        const std::tuple<long, double> t2 = { static_cast<long>(a[0]), a[2] + 1 };
+
+        return static_ranges::equal(a, b)
+            && static_ranges::compare_three_way(a, b) == 0
+            && !static_ranges::lexicographical_compare(a, b)
+            && !static_ranges::equal(t1, t2)
+            && static_ranges::compare_three_way(t1, t2) < 0
+            && static_ranges::lexicographical_compare(t1, t2);
+    }
+
+
+    bool check(bool ok, const char * what) {
+        if (!ok)
+            std::fprintf(stderr, "compare: %s failed\n", what);
+        return ok;
+    }
+
+} // anonymous namespace
+
+
+int main()
+{
+    bool ok = true;
+    ok &= check(equal_ints(), "equal on int arrays");
+    ok &= check(ordered_bytes(), "order of unsigned char arrays");
+    ok &= check(last_element(), "difference in the last element");
+    ok &= check(different_sizes(), "ranges of different sizes");
+    ok &= check(fallback(), "element-wise fallback");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,333 @@
+/*
+* Compile-time test suite: every check is a static_assert, so this
+* translation unit only compiles if the algorithms and views can be
+* evaluated in constant expressions. Running the executable does nothing.
+*/
+
+#include "static_ranges.hpp"
+#include "include/execution.hpp"
+
+#include <array>
+#include <functional>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace {
+
+    struct point {
+        int x;
+        int y;
+    };
+
+
+    // element, size_v
+
+    static_assert(static_ranges::size_v<std::tuple<int, double, char>> == 3);
+    static_assert(static_ranges::element<1>(std::tuple<int, double>{ 1, 2.5 }) == 2.5);
+    static_assert(static_ranges::element<2>(std::array<int, 3>{ 1, 2, 3 }) == 3);
+
+
+    // for_each
+
+    constexpr int sum_for_each() {
+        std::tuple<int, long, short> r = { 1, 2, 3 };
+        int sum = 0;
+        static_ranges::for_each(r, [&sum](auto v) { sum += static_cast<int>(v); });
+        return sum;
+    }
+    static_assert(sum_for_each() == 6);
+
+    constexpr int modify_for_each() {
+        std::array<int, 3> r = { 1, 2, 3 };
+        static_ranges::for_each(r, [](int & v) { v *= 10; });
+        return r[0] + r[1] + r[2];
+    }
+    static_assert(modify_for_each() == 60);
+
+    constexpr int seq_for_each() {
+        std::tuple<int, int> r = { 4, 5 };
+        int sum = 0;
+        static_ranges::for_each(static_ranges::execution::seq, r, [&sum](int v) { sum += v; });
+        return sum;
+    }
+    static_assert(seq_for_each() == 9);
+
+
+    // copy
+
+    constexpr std::tuple<long, double> copied() {
+        std::tuple<int, float> src = { 7, 0.5f };
+        std::tuple<long, double> dest{};
+        static_ranges::copy(src, dest);
+        return dest;
+    }
+    static_assert(copied() == std::tuple<long, double>{ 7, 0.5 });
+
+
+    // transform
+
+    constexpr std::tuple<int, double> transformed_one() {
+        std::tuple<int, double> src = { 1, 1.5 };
+        std::tuple<int, double> dest{};
+        static_ranges::transform(src, dest, [](auto v) { return v * 2; });
+        return dest;
+    }
+    static_assert(transformed_one() == std::tuple<int, double>{ 2, 3.0 });
+
+    constexpr std::array<int, 4> transformed_contiguous() {
+        std::array<int, 4> src1 = { 1, 2, 3, 4 };
+        std::array<int, 4> src2 = { 10, 20, 30, 40 };
+        std::array<int, 4> dest{};
+        static_ranges::transform(src1, src2, dest, std::plus<>());
+        return dest;
+    }
+    static_assert(transformed_contiguous() == std::array<int, 4>{ 11, 22, 33, 44 });
+
+    constexpr std::tuple<int, long> transformed_two() {
+        std::tuple<int, long> src1 = { 1, 2 };
+        std::pair<int, long> src2 = { 3, 4 };
+        std::tuple<int, long> dest{};
+        static_ranges::transform(src1, src2, dest, std::multiplies<>());
+        return dest;
+    }
+    static_assert(transformed_two() == std::tuple<int, long>{ 3, 8 });
+
+
+    // to_tuple, to_pair, to_array, to
+
+    static_assert(static_ranges::to_tuple(std::array<int, 2>{ 1, 2 }) == std::tuple<int, int>{ 1, 2 });
+    static_assert(static_ranges::to_pair(std::tuple<int, char>{ 1, 'a' }) == std::pair<int, char>{ 1, 'a' });
+    static_assert(static_ranges::to_array<long>(std::tuple<int, short, long>{ 1, 2, 3 }) ==
+                  std::array<long, 3>{ 1, 2, 3 });
+
+    static_assert(static_ranges::to<point>(std::tuple<int, int>{ 1, 2 }).y == 2);
+    static_assert(static_ranges::to<std::tuple>(static_views::iota<int, 2>()) == std::tuple<int, int>{ 0, 1 });
+    static_assert(static_ranges::to<std::array<long, 2>>(std::pair<int, short>{ 1, 2 }) == std::array<long, 2>{ 1, 2 });
+
+    // construct_into takes the Target first, like to<Target>
+    constexpr long constructed_into() {
+        std::allocator<std::pair<int, long>> alloc;
+        auto * storage = alloc.allocate(1);
+        auto * p = static_ranges::construct_into<std::pair<int, long>>(std::tuple<short, int>{ 1, 2 }, storage);
+        long sum = p->first + p->second;
+        std::destroy_at(p);
+        alloc.deallocate(storage, 1);
+        return sum;
+    }
+    static_assert(constructed_into() == 3);
+
+    // a lookup table precomputed at build time
+    constexpr auto squares = static_ranges::to_array<int>(
+        static_views::iota<int, 8>() | static_views::transform([](int v) { return v * v; }));
+    static_assert(squares == std::array<int, 8>{ 0, 1, 4, 9, 16, 25, 36, 49 });
+
+
+    // views
+
+    static_assert(static_ranges::element<4>(static_views::iota<int, 5>()) == 4);
+    static_assert(static_ranges::element<3>(static_views::static_iota<int, 5>()).value == 3);
+
+    constexpr int all_modifies() {
+        std::tuple<int, int> r = { 1, 2 };
+        auto v = static_views::all(r);
+        static_ranges::element<1>(v) = 5;
+        return std::get<1>(r);
+    }
+    static_assert(all_modifies() == 5);
+
+    // views of temporaries hold them
+    static_assert(static_ranges::element<1>(std::tuple<int, long>{ 1, 2 } | static_views::reverse) == 1);
+    static_assert(std::is_same_v<decltype(static_views::all(std::tuple<int, long>{ 1, 2 })),
+                                 static_views::owning_view<std::tuple<int, long>>>);
+
+    // owning views, and views over them, are move-only: passing one on as an lvalue is an error
+    using owning_reverse = decltype(std::tuple<int, long>{ 1, 2 } | static_views::reverse);
+    static_assert(!std::is_copy_constructible_v<static_views::owning_view<std::tuple<int, long>>>);
+    static_assert(!std::is_copy_constructible_v<owning_reverse> && std::is_move_constructible_v<owning_reverse>);
+
+    constexpr long moves_owning_views() {
+        auto v = std::tuple<int, long>{ 1, 2 } | static_views::reverse;
+        auto w = std::move(v) | static_views::transform([](auto e) { return e * 10; });
+        return static_ranges::element<0>(w);
+    }
+    static_assert(moves_owning_views() == 20);
+
+    constexpr int all_copies_views() {
+        std::tuple<int, int> r = { 1, 2 };
+        auto v = r | static_views::transform([](int & e) -> int & { return e; });
+        auto w = v | static_views::reverse;
+        static_ranges::element<0>(w) = 5;
+        return static_ranges::element<1>(v);
+    }
+    static_assert(all_copies_views() == 5);
+
+    // const ranges give read-only views, and a const closure can be reused
+    constexpr std::tuple<int, long> config = { 3, 4 };
+    static_assert(std::is_same_v<decltype(static_ranges::element<1>(static_views::all(config))), const long &>);
+
+    constexpr auto twice = static_views::transform([](auto v) { return v * 2; });
+    static_assert(static_ranges::element<1>(config | twice) + static_ranges::element<0>(config | twice) == 14);
+    static_assert(static_ranges::element<0>(static_views::iota<int, 2>() | twice | twice | static_views::reverse) == 4);
+
+    constexpr int chained_transform() {
+        auto closure = static_views::transform([](int v) { return v + 1; })
+                     | static_views::transform([](int v) { return v * 2; });
+        auto v = static_views::iota<int, 4>() | closure | static_views::transform([](int v) { return v - 3; });
+        return static_ranges::element<3>(v);
+    }
+    static_assert(chained_transform() == 5);
+
+    // an lvalue functor is copied into the view, not moved from, so it
+    // keeps its state after r | transform(f), also when composed
+    struct scale {
+        std::vector<int> factors;
+
+        constexpr int operator()(int v) const {
+            return v * factors[0];
+        }
+    };
+
+    constexpr bool reuses_lvalue_functor() {
+        scale f{ { 10 } };
+        std::array<int, 2> r = { 1, 2 };
+        auto v = r | static_views::transform(f);
+        auto w = r | static_views::transform(f) | static_views::transform(f);
+        auto x = static_views::transform(r, f);
+        return f.factors.size() == 1 && f(3) == 30 && static_ranges::element<1>(v) == 20 &&
+               static_ranges::element<1>(w) == 200 && static_ranges::element<0>(x) == 10;
+    }
+    static_assert(reuses_lvalue_functor());
+
+    constexpr int projected() {
+        std::tuple<point, point> r = { point{ 1, 2 }, point{ 3, 4 } };
+        auto ys = r | static_views::project(&point::y);
+        static_ranges::element<0>(ys) = 20;
+        return std::get<0>(r).y + static_ranges::element<1>(ys);
+    }
+    static_assert(projected() == 24);
+
+    // the projection of a temporary element is returned by value
+    constexpr auto make_point = static_views::transform([](int v) { return point{ v, v + 1 }; });
+    static_assert(std::is_same_v<
+        decltype(static_ranges::element<0>(static_views::iota<int, 2>() | make_point | static_views::project(&point::y))),
+        int>);
+    static_assert(static_ranges::element<1>(static_views::iota<int, 2>() | make_point | static_views::project(&point::y)) == 2);
+
+    constexpr int zipped() {
+        std::tuple<int, long> r1 = { 1, 2 };
+        std::array<int, 2> r2 = { 10, 20 };
+        auto z = static_views::zip(r1, r2);
+        std::get<1>(static_ranges::element<1>(z)) += std::get<0>(static_ranges::element<1>(z));
+        return r2[1];
+    }
+    static_assert(zipped() == 22);
+
+    constexpr long zip_transformed() {
+        std::tuple<int, long> r1 = { 1, 2 };
+        std::array<int, 2> r2 = { 10, 20 };
+        auto sums = static_views::zip_transform(std::plus<>(), r1, r2);
+        return static_ranges::element<0>(sums) + static_ranges::element<1>(sums);
+    }
+    static_assert(zip_transformed() == 33);
+
+    constexpr std::size_t enumerated() {
+        std::tuple<int, double, char> r = { 1, 2.0, 'c' };
+        std::size_t sum = 0;
+        static_ranges::for_each(static_views::enumerate(r), [&sum](auto && p) {
+            sum += std::tuple_element_t<0, std::remove_cvref_t<decltype(p)>>::value;
+        });
+        return sum;
+    }
+    static_assert(enumerated() == 3);
+
+    constexpr int filtered() {
+        std::tuple<int, point, long, point> r = { 1, point{ 2, 3 }, 4, point{ 5, 6 } };
+        auto points = r | static_views::filter_types<std::is_class>;
+        static_assert(static_ranges::size_v<decltype(points)> == 2);
+        return static_ranges::element<1>(points).x;
+    }
+    static_assert(filtered() == 5);
+
+    constexpr int concatenated() {
+        std::tuple<int, long> r1 = { 1, 2 };
+        std::tuple<> r2;
+        std::array<int, 2> r3 = { 10, 20 };
+        auto c = static_views::concat(r1, r2, r3) | static_views::transform([](auto & v) -> auto & { return v; });
+        static_assert(static_ranges::size_v<decltype(c)> == 4);
+        static_assert(std::is_same_v<decltype(static_ranges::element<1>(c)), long &>);
+        static_ranges::element<3>(c) += static_ranges::element<0>(c);
+        return r3[1] + static_ranges::fold_left(static_views::concat(r3, static_views::static_iota<int, 3>()), 0,
+            [](int acc, auto v) { return acc + static_cast<int>(v); });
+    }
+    static_assert(concatenated() == 21 + 10 + 21 + 0 + 1 + 2);
+
+    constexpr int sliced() {
+        std::array<int, 7> r = { 0, 1, 2, 3, 4, 5, 6 };
+        auto v = r | static_views::drop<1> | static_views::stride<2> | static_views::reverse | static_views::take<2>;
+        static_assert(std::is_same_v<decltype(v),
+            static_views::filter_view_object<static_views::view_obj<std::array<int, 7>>, std::index_sequence<5, 3>>>);
+        static_ranges::element<0>(v) *= 10;
+        return r[5] + static_ranges::element<1>(v);
+    }
+    static_assert(sliced() == 53);
+
+    static_assert(static_ranges::size_v<decltype(std::declval<std::tuple<int, char> &>() | static_views::take<5>)> == 2);
+    static_assert(static_ranges::size_v<decltype(std::declval<std::tuple<int, char> &>() | static_views::drop<5>)> == 0);
+    static_assert(static_ranges::size_v<decltype(std::declval<std::tuple<int, char, long> &>() | static_views::stride<2>)> == 2);
+
+    // cache fills its slots through a mutable member, which GCC 12 rejects
+    // in constant expressions, so only the element types are checked here
+    using cached = decltype(std::declval<std::tuple<int, long> &>()
+        | static_views::transform([](auto v) { return v * 10; }) | static_views::cache);
+    static_assert(std::is_same_v<decltype(static_ranges::element<1>(std::declval<cached &>())), long &>);
+    static_assert(std::is_same_v<decltype(static_ranges::element<1>(std::declval<const cached &>())), const long &>);
+
+
+    // fold, reduce, transform_reduce
+
+    static_assert(static_ranges::fold_left(std::tuple<int, long, short>{ 1, 2, 3 }, 0L, std::minus<>()) == -6);
+    static_assert(static_ranges::fold_right(std::tuple<int, long, short>{ 1, 2, 3 }, 0L, std::minus<>()) == 2);
+
+    // fold must not pick up the shift operators of the element types
+    namespace greedy {
+        struct stream { int v; };
+        template<typename T> constexpr int operator << (T &&, stream &&) { return -1; }
+        template<typename T> constexpr int operator >> (stream &&, T &&) { return -1; }
+    }
+    static_assert(static_ranges::fold_left(std::tuple<greedy::stream, greedy::stream>{ { 1 }, { 2 } }, 0,
+                                           [](int acc, greedy::stream s) { return acc * 10 + s.v; }) == 12);
+    static_assert(static_ranges::fold_right(std::tuple<greedy::stream, greedy::stream>{ { 1 }, { 2 } }, 0,
+                                            [](greedy::stream s, int acc) { return acc * 10 + s.v; }) == 21);
+    static_assert(static_ranges::reduce(std::array<int, 5>{ 1, 2, 3, 4, 5 }, std::plus<>()) == 15);
+    static_assert(static_ranges::transform_reduce(std::array<int, 3>{ 1, 2, 3 }, std::array<int, 3>{ 4, 5, 6 },
+                                                  0, std::plus<>(), std::multiplies<>()) == 32);
+
+
+    // equal, compare_three_way, lexicographical_compare
+
+    static_assert(static_ranges::equal(std::tuple<int, long>{ 1, 2 }, std::pair<short, int>{ 1, 2 }));
+    static_assert(!static_ranges::equal(std::tuple<int, long>{ 1, 2 }, std::tuple<int, long, int>{ 1, 2, 3 }));
+    static_assert(static_ranges::equal(std::array<int, 3>{ 1, 2, 3 }, std::array<int, 3>{ 1, 2, 3 }));
+    static_assert(static_ranges::compare_three_way(std::tuple<int, double>{ 1, 2.0 }, std::tuple<int, double>{ 1, 3.0 }) < 0);
+    static_assert(static_ranges::compare_three_way(std::array<unsigned char, 2>{ 1, 2 }, std::array<unsigned char, 1>{ 1 }) > 0);
+    static_assert(static_ranges::lexicographical_compare(std::tuple<int, int>{ 1, 2 }, std::tuple<int, int, int>{ 1, 2, 0 }));
+
+
+    // visit_at
+
+    static_assert(static_ranges::visit_at(std::tuple<int, long, short>{ 1, 2, 3 }, 2,
+                                          [](auto v) { return static_cast<long>(v); }) == 3);
+    static_assert(static_ranges::visit_at(std::tuple<int, long>{ 1, 2 }, 5,
+                                          [](auto v) { return static_cast<long>(v); },
+                                          [] { return -1L; }) == -1);
+
+} // anonymous namespace
+
+
+int main()
+{
+    return 0;
+}
@@ -0,0 +1,119 @@
+/*
+* execution test: runs for_each and transform with the parallel policy, with
+* the shared counter and with work stealing, on a pool of its own, and checks
+* that every element is visited exactly once and that the results equal the
+* ones of the sequential policy, for homogeneous and heterogeneous ranges.
+*/
+
+#include "static_ranges.hpp"
+#include "include/execution.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+
+namespace {
+
+    namespace ex = static_ranges::execution;
+
+    // not a multiple of the number of participants, so the shares are uneven
+    constexpr std::size_t size = 203;
+
+    using numbers = std::array<long, size>;
+    using record = std::tuple<int, std::string, double, std::string, long>;
+
+
+    numbers make_numbers() {
+        numbers a;
+        for (std::size_t i = 0; i < size; ++i)
+            a[i] = static_cast<long>(i * 7 % 31);
+        return a;
+    }
+
+    bool visits_once(const ex::parallel_policy & policy) {
+        std::array<std::atomic<int>, size> visits{};
+        std::array<std::size_t, size> indices;
+        for (std::size_t i = 0; i < size; ++i)
+            indices[i] = i;
+
+        static_ranges::for_each(policy, indices, [&visits](std::size_t i) {
+            visits[i].fetch_add(1, std::memory_order_relaxed);
+        });
+
+        for (auto & v : visits)
+            if (v.load() != 1)
+                return false;
+        return true;
+    }
+
+    bool transforms_like_seq(const ex::parallel_policy & policy) {
+        const numbers a = make_numbers();
+        numbers b;
+        for (std::size_t i = 0; i < size; ++i)
+            b[i] = static_cast<long>(size - i);
+
+        auto one = [](long x) { return x * x - 3; };
+        auto two = [](long x, long y) { return x * 31 + y; };
+
+        numbers seq_one, par_one, seq_two, par_two;
+        static_ranges::transform(ex::seq, a, seq_one, one);
+        static_ranges::transform(policy, a, par_one, one);
+        static_ranges::transform(ex::seq, a, b, seq_two, two);
+        static_ranges::transform(policy, a, b, par_two, two);
+
+        const record r = { 1, "Foo", 2.5, "Bar", 4 };
+        record seq_r, par_r;
+        auto twice = [](const auto & e) { return e + e; };
+        static_ranges::transform(ex::seq, r, seq_r, twice);
+        static_ranges::transform(policy, r, par_r, twice);
+
+        return par_one == seq_one && par_two == seq_two && par_r == seq_r;
+    }
+
+    bool rethrows(const ex::parallel_policy & policy) {
+        const numbers a = make_numbers();
+        try {
+            static_ranges::for_each(policy, a, [](long x) {
+                if (x == 30)
+                    throw std::runtime_error("30");
+            });
+            return false;
+        }
+        catch (const std::runtime_error &) {
+            return true;
+        }
+    }
+
+
+    bool check(bool ok, const char * what) {
+        if (!ok)
+            std::fprintf(stderr, "execution: %s failed\n", what);
+        return ok;
+    }
+
+} // anonymous namespace
+
+
+int main()
+{
+    ex::thread_pool pool(4);
+    // threshold 2 so the 5 element record goes through the pool as well
+    const ex::parallel_policy policies[] = {
+        ex::par.with_pool(pool).with_sequential_threshold(2),
+        ex::par.with_pool(pool).with_sequential_threshold(2).with_work_stealing(),
+        ex::par.with_pool(pool).with_sequential_threshold(2).with_work_stealing().with_max_concurrency(3),
+    };
+
+    bool ok = true;
+    for (int run = 0; run < 20; ++run) {
+        for (const auto & policy : policies) {
+            ok &= check(visits_once(policy), "par for_each");
+            ok &= check(transforms_like_seq(policy), "par transform");
+            ok &= check(rethrows(policy), "par exception");
+        }
+    }
+    return ok ? 0 : 1;
+}
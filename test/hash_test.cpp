@@ -0,0 +1,128 @@
+/*
+* hash test: checks at compile time which ranges take the contiguous path,
+* and at run time that equal ranges hash equal and distinct ones almost never
+* collide, that the contiguous path of an array of integers gives the hash of
+* the element-wise path, that nested ranges are hashed recursively, and that
+* hasher works as the hash of a std::unordered_map.
+*/
+
+#include "static_ranges.hpp"
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+namespace {
+
+    using key = std::tuple<int, std::string, double>;
+    using numbers = std::array<int, 13>;
+
+    static_assert(static_ranges::integer_span_hashable<numbers>);
+    static_assert(static_ranges::integer_span_hashable<std::array<std::uint8_t, 3>>);
+    static_assert(!static_ranges::integer_span_hashable<std::tuple<int, int>>);
+    static_assert(!static_ranges::integer_span_hashable<std::array<double, 2>>);
+    static_assert(!static_ranges::integer_span_hashable<std::array<std::array<int, 2>, 2>>);
+
+
+    std::size_t elementwise(const numbers & a) {
+        return static_cast<std::size_t>(
+            static_ranges::hash_impl<make_sequence<numbers>>::call(a));
+    }
+
+    numbers make_numbers(int seed) {
+        numbers a;
+        for (std::size_t i = 0; i < a.size(); ++i)
+            a[i] = static_cast<int>(i) * 37 - seed;
+        return a;
+    }
+
+
+    bool equal_and_distinct() {
+        const key a = { 42, "Foo", 2.5 };
+        const key b = a;
+        if (static_ranges::hash(a) != static_ranges::hash(b))
+            return false;
+
+        // 3 * 10^4 distinct keys, differing in a single element or in all
+        std::unordered_set<std::size_t> hashes;
+        std::size_t keys = 0;
+        for (int i = 0; i < 10000; ++i) {
+            hashes.insert(static_ranges::hash(key{ i, "Foo", 2.5 }));
+            hashes.insert(static_ranges::hash(key{ 0, std::to_string(i) + "Bar", 2.5 }));
+            hashes.insert(static_ranges::hash(std::tuple<short, char>{ static_cast<short>(i), 'x' }));
+            keys += 3;
+        }
+        return keys - hashes.size() <= 1;
+    }
+
+    bool contiguous_like_elementwise() {
+        for (int seed = -50; seed < 50; ++seed) {
+            const numbers a = make_numbers(seed);
+            if (static_ranges::hash(a) != elementwise(a))
+                return false;
+        }
+
+        const std::array<int, 3> a = { -1, 0, 7 };
+        const std::tuple<int, int, int> t = { -1, 0, 7 };
+        return static_ranges::hash(a) == static_ranges::hash(t)
+            && static_ranges::hash(a) != static_ranges::hash(std::array<int, 3>{ -1, 0, 8 });
+    }
+
+    bool nested() {
+        using inner = std::tuple<std::string, std::array<short, 3>>;
+        using outer = std::tuple<int, inner>;
+
+        const outer r = { 7, { "Foo", { 1, 2, 3 } } };
+
+        // the outer hash folds the hash of the inner range as one element
+        std::uint64_t h = static_ranges::hash_state::seed;
+        h = static_ranges::hash_state::step(h, static_ranges::hash_state::integer(7));
+        h = static_ranges::hash_state::step(h, static_ranges::hash(std::get<1>(r)));
+        if (static_ranges::hash(r) != static_cast<std::size_t>(static_ranges::hash_state::finalize(h)))
+            return false;
+
+        outer changed = r;
+        std::get<2>(std::get<1>(std::get<1>(changed))) = 4;
+        return static_ranges::hash(r) != static_ranges::hash(changed);
+    }
+
+    bool map_key() {
+        std::unordered_map<key, int, static_ranges::hasher> map;
+        for (int i = 0; i < 1000; ++i)
+            map.emplace(key{ i, std::to_string(i % 10), i * 0.5 }, i);
+        map[key{ 3, "3", 1.5 }] += 1000;
+
+        if (map.size() != 1000)
+            return false;
+        for (int i = 0; i < 1000; ++i) {
+            auto it = map.find(key{ i, std::to_string(i % 10), i * 0.5 });
+            if (it == map.end() || it->second != (i == 3 ? 1003 : i))
+                return false;
+        }
+        return map.find(key{ 1, "2", 0.5 }) == map.end();
+    }
+
+
+    bool check(bool ok, const char * what) {
+        if (!ok)
+            std::fprintf(stderr, "hash: %s failed\n", what);
+        return ok;
+    }
+
+} // anonymous namespace
+
+
+int main()
+{
+    bool ok = true;
+    ok &= check(equal_and_distinct(), "equal and distinct keys");
+    ok &= check(contiguous_like_elementwise(), "contiguous path");
+    ok &= check(nested(), "nested ranges");
+    ok &= check(map_key(), "unordered_map key");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,104 @@
+/*
+* instrumentation test: checks at compile time that a disabled profile costs
+* nothing, i.e. it is empty and the instrumented view is the plain one, and
+* at run time that an enabled profile counts every call per index; running
+* it prints the report of a transform view.
+*/
+
+#include "static_ranges.hpp"
+#include "include/instrumentation.hpp"
+
+#include <array>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <tuple>
+#include <type_traits>
+
+namespace {
+
+    namespace instrumentation = static_ranges::instrumentation;
+
+    using range = std::tuple<int, std::string, double>;
+    using disabled_profile = instrumentation::profile_for<range, false>;
+    using enabled_profile = instrumentation::profile_for<range, true>;
+
+
+    // disabled: no state, no wrapper
+
+    static_assert(std::is_empty_v<disabled_profile>);
+
+    static_assert(std::is_same_v<decltype(std::declval<const disabled_profile &>().name()),
+                                 decltype(std::declval<const enabled_profile &>().name())>);
+
+    static_assert(std::is_same_v<
+        decltype(std::declval<range &>() | static_views::instrumented(std::declval<disabled_profile &>())),
+        decltype(static_views::all(std::declval<range &>()))>);
+
+    constexpr int disabled_for_each() {
+        std::array<int, 3> a = { 1, 2, 3 };
+        instrumentation::profile_for<decltype(a), false> profile;
+        int sum = 0;
+        static_ranges::for_each(static_ranges::execution::instrumented(profile), a, [&sum](int v) { sum += v; });
+        return sum;
+    }
+    static_assert(disabled_for_each() == 6);
+
+
+    // enabled: the references the view returns are kept
+
+    static_assert(std::is_same_v<
+        decltype(static_ranges::element<1>(
+            std::declval<range &>() | static_views::instrumented(std::declval<enabled_profile &>()))),
+        std::string &>);
+
+
+    bool counts() {
+        range r = { 1, "Foo", 2.5 };
+        range dest;
+        enabled_profile profile("range");
+
+        auto run = static_ranges::execution::instrumented(profile);
+        static_ranges::for_each(run, r, [](auto &) {});
+        static_ranges::copy(run, r, dest);
+        static_ranges::transform(run, r, dest, [](auto && v) { return v + v; });
+        static_ranges::transform(run, r, dest, dest, [](auto && v, auto && w) { return v + w; });
+
+        auto view = r | static_views::instrumented(profile);
+        static_ranges::element<1>(view) += "Bar";
+
+        for (std::size_t i = 0; i < 3; ++i)
+            if (profile[i].calls != (i == 1 ? 5u : 4u))
+                return false;
+
+        return std::get<1>(r) == "FooBar" && std::get<1>(dest) == "FooFooFoo" && std::get<2>(dest) == 7.5
+            && profile.name() == "range" && disabled_profile("range").name().empty();
+    }
+
+} // anonymous namespace
+
+
+int main()
+{
+    if (!counts()) {
+        std::cerr << "instrumentation: wrong call counts\n";
+        return 1;
+    }
+
+    std::tuple<int, std::string, std::array<double, 256>> r = { 42, std::string(1000, 'x'), {} };
+    instrumentation::profile_for<decltype(r), true> profile("transform");
+
+    auto sizes = r | static_views::transform([](auto && e) {
+        if constexpr (static_ranges::range<std::remove_cvref_t<decltype(e)>>)
+            return static_ranges::fold_left(e, 0.0, [](double acc, double v) { return acc + v * v; });
+        else if constexpr (std::is_same_v<std::remove_cvref_t<decltype(e)>, std::string>)
+            return static_cast<double>(std::hash<std::string>()(e) % 100);
+        else
+            return static_cast<double>(e);
+    }) | static_views::instrumented(profile);
+
+    for (int i = 0; i < 1000; ++i)
+        static_ranges::to_array<double>(sizes);
+
+    profile.report(std::cout);
+}
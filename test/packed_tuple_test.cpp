@@ -0,0 +1,82 @@
+/*
+* packed_tuple test: checks at compile time that packed_tuple is never
+* larger than the std::tuple of the same types and that the algorithms
+* see its elements in logical order; running it prints the sizeof savings.
+*/
+
+#include "static_ranges.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <tuple>
+#include <type_traits>
+
+namespace {
+
+    struct empty {
+        constexpr bool operator == (const empty &) const = default;
+    };
+
+
+    template<typename ... Ts>
+    constexpr bool no_larger = sizeof(static_ranges::packed_tuple<Ts ...>) <= sizeof(std::tuple<Ts ...>);
+
+    static_assert(no_larger<char, double, short, std::int64_t>);
+    static_assert(no_larger<char, int, char, int, char, int>);
+    static_assert(no_larger<double, double>);
+    static_assert(no_larger<char>);
+    static_assert(no_larger<char, empty, double>);
+
+    static_assert(sizeof(static_ranges::packed_tuple<char, double, short, std::int64_t>) == 24);
+    static_assert(sizeof(static_ranges::packed_tuple<char, int, char, int, char, int>) == 16);
+
+
+    // logical order is kept
+
+    static_assert(std::is_same_v<
+        decltype(static_ranges::element<2>(std::declval<static_ranges::packed_tuple<char, double, short> &>())),
+        short &>);
+
+    constexpr double logical_order() {
+        static_ranges::packed_tuple<char, double, short, std::int64_t> t = { 'a', 1.5, 2, 40 };
+        static_ranges::element<1>(t) += 1.0;
+        double sum = 0;
+        static_ranges::for_each(t, [&sum](auto v) { sum += static_cast<double>(v); });
+        return sum - 'a';
+    }
+    static_assert(logical_order() == 44.5);
+
+    constexpr bool copy_round_trip() {
+        std::tuple<char, double, short> src = { 'x', 2.5, 7 };
+        static_ranges::packed_tuple<char, double, short> packed;
+        static_ranges::copy(src, packed);
+        std::tuple<char, double, short> dest;
+        static_ranges::copy(packed, dest);
+        return src == dest && static_ranges::equal(src, packed);
+    }
+    static_assert(copy_round_trip());
+
+
+    template<typename ... Ts>
+    void report(const char * name)
+    {
+        std::size_t unpacked = sizeof(std::tuple<Ts ...>);
+        std::size_t packed = sizeof(static_ranges::packed_tuple<Ts ...>);
+        std::printf("%-44s %8zu %8zu %8zu\n", name, unpacked, packed, unpacked - packed);
+    }
+
+} // anonymous namespace
+
+
+int main()
+{
+    std::printf("%-44s %8s %8s %8s\n", "types", "tuple", "packed", "saved");
+
+    report<char, double, short, std::int64_t>("char, double, short, int64_t");
+    report<char, int, char, int, char, int>("char, int, char, int, char, int");
+    report<bool, double, bool, double, bool>("bool, double, bool, double, bool");
+    report<char, std::string, short, int>("char, string, short, int");
+    report<char, empty, double>("char, empty, double");
+    report<double, double>("double, double");
+}
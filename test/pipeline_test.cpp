@@ -0,0 +1,113 @@
+/*
+* pipeline test: checks that run_pipeline gives the same records in fused
+* and batched mode, for batches which are not a multiple of the block size,
+* blocks of one record, the default block size, whole-batch blocks and empty
+* batches, over spans of static and dynamic extent.
+*/
+
+#include "static_ranges.hpp"
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <span>
+#include <tuple>
+#include <vector>
+
+namespace {
+
+    using mode = static_ranges::pipeline_mode;
+
+    struct record {
+        std::uint64_t value;
+        std::uint64_t trace = 0;
+
+        bool operator == (const record &) const = default;
+    };
+
+    // the stages do not commute, and every stage leaves its index in the
+    // trace, so a stage skipped, repeated or run out of order shows
+    template<std::uint64_t Id>
+    struct traced {
+        std::uint64_t (* op)(std::uint64_t);
+
+        void operator()(record & r) const {
+            r.value = op(r.value);
+            r.trace = r.trace * 8 + Id;
+        }
+    };
+
+    const auto stages = std::make_tuple(
+        traced<1>{ [](std::uint64_t v) { return v * 3 + 1; } },
+        traced<2>{ [](std::uint64_t v) { return v ^ (v >> 2); } },
+        traced<3>{ [](std::uint64_t v) { return v - 5; } });
+
+    constexpr std::uint64_t trace = (1 * 8 + 2) * 8 + 3;
+
+
+    std::vector<record> make_records(std::size_t n) {
+        std::vector<record> records;
+        for (std::size_t i = 0; i < n; ++i)
+            records.push_back({ i * 7919 % 1000 });
+        return records;
+    }
+
+    template<std::size_t Block>
+    bool same_in_dynamic(std::size_t n) {
+        std::vector<record> fused = make_records(n);
+        std::vector<record> batched = fused;
+
+        static_ranges::run_pipeline<mode::fused>(stages, std::span(fused));
+        static_ranges::run_pipeline<mode::batched, Block>(stages, std::span(batched));
+
+        for (const record & r : fused)
+            if (r.trace != trace)
+                return false;
+        return fused == batched;
+    }
+
+    template<std::size_t Block, std::size_t N>
+    bool same_in_static() {
+        std::array<record, N> fused;
+        for (std::size_t i = 0; i < N; ++i)
+            fused[i] = { i * 7919 % 1000 };
+        std::array<record, N> batched = fused;
+
+        static_ranges::run_pipeline<mode::fused>(stages, std::span<record, N>(fused));
+        static_ranges::run_pipeline<mode::batched, Block>(stages, std::span<record, N>(batched));
+
+        for (const record & r : fused)
+            if (r.trace != trace)
+                return false;
+        return fused == batched;
+    }
+
+
+    bool check(bool ok, const char * what) {
+        if (!ok)
+            std::fprintf(stderr, "pipeline: %s failed\n", what);
+        return ok;
+    }
+
+} // anonymous namespace
+
+
+int main()
+{
+    constexpr std::size_t block = static_ranges::pipeline_block_size;
+
+    bool ok = true;
+    ok &= check(same_in_dynamic<64>(1000), "dynamic extent, partial last block");
+    ok &= check(same_in_dynamic<1>(37), "dynamic extent, block of 1");
+    ok &= check(same_in_dynamic<block>(3 * block + 5), "dynamic extent, default block");
+    ok &= check(same_in_dynamic<0>(100), "dynamic extent, whole batch");
+    ok &= check(same_in_dynamic<block>(0), "dynamic extent, empty batch");
+    ok &= check(same_in_dynamic<1>(0), "dynamic extent, empty batch of blocks of 1");
+
+    ok &= check(same_in_static<64, 1000>(), "static extent, partial last block");
+    ok &= check(same_in_static<1, 37>(), "static extent, block of 1");
+    ok &= check(same_in_static<block, 3 * block + 5>(), "static extent, default block");
+    ok &= check(same_in_static<0, 100>(), "static extent, whole batch");
+    ok &= check(same_in_static<block, 0>(), "static extent, empty batch");
+    return ok ? 0 : 1;
+}
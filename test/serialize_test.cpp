@@ -0,0 +1,124 @@
+/*
+* serialize test: checks at compile time the packed layout of nested static
+* ranges, and at run time that serialize/deserialize round trip, including
+* empty nested ranges, that merged copies of adjacent leaves round trip like
+* per-leaf ones, that the serialized view reads the same values in place, and
+* that too small buffers are rejected.
+*/
+
+#include "static_ranges.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+namespace {
+
+    using record = std::tuple<int, std::array<double, 3>, std::tuple<>, char, std::tuple<short, std::tuple<>, float>>;
+
+    static_assert(static_ranges::serialized_size_v<record> == 4 + 24 + 0 + 1 + (2 + 0 + 4));
+    static_assert(static_ranges::serialized_layout<record>::offsets[3] == 28);
+    static_assert(static_ranges::serialized_layout<std::array<int, 4>>::trivial_run);
+    static_assert(!static_ranges::serialized_layout<record>::trivial_run);
+    static_assert(static_ranges::serialized_size_v<std::tuple<>> == 0);
+
+
+    bool round_trip() {
+        record r = { 42, { 1.0, 2.5, -3.0 }, {}, 'a', { 7, {}, 0.5f } };
+        std::array<std::byte, static_ranges::serialized_size_v<record> + 8> buffer{};
+
+        auto written = static_ranges::serialize(r, buffer);
+        if (written.size() != static_ranges::serialized_size_v<record>)
+            return false;
+
+        return static_ranges::deserialize<record>(written) == r
+            && static_ranges::deserialize<std::tuple<>>(std::span<const std::byte>()) == std::tuple<>{};
+    }
+
+    // pairs of leaves are adjacent in memory and copied in one block, except
+    // across padding; nested non-trivial runs and views returning values are not
+    bool merged_runs() {
+        using leaves = std::pair<int, float>;
+        using padded = std::pair<char, int>;
+        using mixed = std::tuple<std::pair<double, std::array<short, 3>>, std::tuple<char, std::pair<int, int>>, padded>;
+
+        const leaves a = { 7, 0.25f };
+        const padded b = { 'x', -3 };
+        const mixed c = { { 1.5, { 1, 2, 3 } }, { 'y', { 4, 5 } }, { 'z', 6 } };
+        std::array<std::byte, static_ranges::serialized_size_v<mixed>> buffer{};
+
+        static_ranges::serialize(a, buffer);
+        int i;
+        float f;
+        std::memcpy(&i, buffer.data(), 4);
+        std::memcpy(&f, buffer.data() + 4, 4);
+        if (i != 7 || f != 0.25f || static_ranges::deserialize<leaves>(std::span(buffer).first(8)) != a)
+            return false;
+
+        static_ranges::serialize(b, buffer);
+        std::memcpy(&i, buffer.data() + 1, 4);
+        if (buffer[0] != std::byte{ 'x' } || i != -3 || static_ranges::deserialize<padded>(buffer) != b)
+            return false;
+
+        static_ranges::serialize(c, buffer);
+        if (static_ranges::deserialize<mixed>(buffer) != c)
+            return false;
+
+        auto doubled = std::pair<int, int>{ 2, 3 } | static_views::transform([](int v) { return v * 2; });
+        static_ranges::serialize(doubled, buffer);
+        return static_ranges::deserialize<std::pair<int, int>>(buffer) == std::pair<int, int>{ 4, 6 };
+    }
+
+    bool in_place() {
+        record r = { 42, { 1.0, 2.5, -3.0 }, {}, 'a', { 7, {}, 0.5f } };
+        std::array<std::byte, static_ranges::serialized_size_v<record>> buffer;
+        static_ranges::serialize(r, buffer);
+
+        auto view = static_views::serialized<record>(buffer);
+        return static_ranges::element<0>(view) == 42
+            && static_ranges::element<1>(static_ranges::element<1>(view)) == 2.5
+            && static_ranges::element<3>(view) == 'a'
+            && static_ranges::element<2>(static_ranges::element<4>(view)) == 0.5f;
+    }
+
+    bool too_small() {
+        record r{};
+        std::array<std::byte, static_ranges::serialized_size_v<record> - 1> buffer;
+        try {
+            static_ranges::serialize(r, buffer);
+            return false;
+        }
+        catch (const std::length_error &) {
+        }
+        try {
+            static_ranges::deserialize<record>(buffer);
+            return false;
+        }
+        catch (const std::length_error &) {
+        }
+        return true;
+    }
+
+
+    bool check(bool ok, const char * what) {
+        if (!ok)
+            std::fprintf(stderr, "serialize: %s failed\n", what);
+        return ok;
+    }
+
+} // anonymous namespace
+
+
+int main()
+{
+    bool ok = true;
+    ok &= check(round_trip(), "round trip");
+    ok &= check(merged_runs(), "merged copies");
+    ok &= check(in_place(), "serialized view");
+    ok &= check(too_small(), "buffer size check");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,73 @@
+/*
+* simd test: checks that transform with execution::unseq gives the results
+* of execution::seq, for sizes below, at and above the native SIMD width,
+* including ones which are not a multiple of it, so both the vector loop and
+* the scalar remainder run, and for ranges falling back to the plain transform.
+*/
+
+#include "static_ranges.hpp"
+#include "include/simd.hpp"
+
+#include <array>
+#include <cstdio>
+#include <tuple>
+
+namespace {
+
+    namespace ex = static_ranges::execution;
+
+
+    template<typename T, std::size_t N>
+    bool transforms_like_seq() {
+        std::array<T, N> a, b;
+        for (std::size_t i = 0; i < N; ++i) {
+            a[i] = static_cast<T>(i % 17);
+            b[i] = static_cast<T>(N - i);
+        }
+
+        auto one = [](auto x) { return x * T(3) + T(2); };
+        auto two = [](auto x, auto y) { return x * y - x; };
+
+        std::array<T, N> seq_one, unseq_one, seq_two, unseq_two;
+        static_ranges::transform(ex::seq, a, seq_one, one);
+        static_ranges::transform(ex::unseq, a, unseq_one, one);
+        static_ranges::transform(ex::seq, a, b, seq_two, two);
+        static_ranges::transform(ex::unseq, a, b, unseq_two, two);
+
+        return unseq_one == seq_one && unseq_two == seq_two;
+    }
+
+    template<typename T>
+    bool all_sizes(const char * type) {
+        bool ok = transforms_like_seq<T, 1>() && transforms_like_seq<T, 3>() && transforms_like_seq<T, 16>()
+               && transforms_like_seq<T, 64>() && transforms_like_seq<T, 67>() && transforms_like_seq<T, 101>();
+        if (!ok)
+            std::fprintf(stderr, "simd: unseq transform of %s differs from seq\n", type);
+        return ok;
+    }
+
+    bool falls_back() {
+        const std::tuple<int, double, long> r = { 1, 2.5, 3 };
+        std::tuple<int, double, long> seq_r, unseq_r;
+        auto twice = [](auto x) { return x + x; };
+        static_ranges::transform(ex::seq, r, seq_r, twice);
+        static_ranges::transform(ex::unseq, r, unseq_r, twice);
+
+        if (unseq_r != seq_r)
+            std::fprintf(stderr, "simd: unseq transform of a tuple differs from seq\n");
+        return unseq_r == seq_r;
+    }
+
+} // anonymous namespace
+
+
+int main()
+{
+    bool ok = true;
+    ok &= all_sizes<float>("float");
+    ok &= all_sizes<double>("double");
+    ok &= all_sizes<int>("int");
+    ok &= all_sizes<short>("short");
+    ok &= falls_back();
+    return ok ? 0 : 1;
+}
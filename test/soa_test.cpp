@@ -0,0 +1,128 @@
+/*
+* soa test: checks at compile time the column types and the row view of a
+* soa_table, and at run time that rows round trip through the columns, that
+* the column-wise algorithms see every entry, and that a push_back which
+* throws half-way leaves the table unchanged.
+*/
+
+#include "static_ranges.hpp"
+
+#include <array>
+#include <cstdio>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace {
+
+    using record = std::tuple<int, double, std::string>;
+    using table_type = static_ranges::soa_table<record>;
+
+
+    // the size of a table is the size of its columns, so it needs at least one
+    template<typename Range>
+    concept storable = requires { typename static_ranges::soa_table<Range>; };
+
+    static_assert(storable<record>);
+    static_assert(storable<std::tuple<char>>);
+    static_assert(!storable<std::tuple<>>);
+    static_assert(!storable<std::array<int, 0>>);
+
+    static_assert(std::is_same_v<table_type::columns_type,
+        std::tuple<std::vector<int>, std::vector<double>, std::vector<std::string>>>);
+
+    static_assert(std::is_same_v<decltype(std::declval<table_type &>().column<1>()), std::span<double>>);
+    static_assert(std::is_same_v<decltype(std::declval<const table_type &>().column<1>()), std::span<const double>>);
+
+    static_assert(static_ranges::range<static_ranges::soa_row<table_type>>);
+    static_assert(std::is_same_v<
+        decltype(static_ranges::element<2>(std::declval<table_type &>()[0])), std::string &>);
+    static_assert(std::is_same_v<
+        decltype(static_ranges::element<2>(std::declval<const table_type &>()[0])), const std::string &>);
+
+
+    // copying it throws once the global budget is used up
+    int copy_budget = 0;
+
+    struct throwing_copy {
+        throwing_copy() = default;
+        throwing_copy(const throwing_copy &) {
+            if (copy_budget-- <= 0)
+                throw std::runtime_error("throwing_copy");
+        }
+        throwing_copy & operator = (const throwing_copy &) = default;
+    };
+
+
+    bool rows() {
+        table_type table;
+        table.push_back(record{ 1, 1.5, "Foo" });
+        record r = { 2, 2.5, "Bar" };
+        table.push_back(r);
+        table.push_back(std::make_tuple(3L, 3.5f, "Baz"));
+
+        static_ranges::element<2>(table[0]) += "Bar";
+
+        return table.size() == 3 && table.get(0) == record{ 1, 1.5, "FooBar" }
+            && table.get(1) == r && table.get(2) == record{ 3, 3.5, "Baz" };
+    }
+
+    bool columns() {
+        table_type table;
+        for (int i = 0; i < 4; ++i)
+            table.push_back(record{ i, i * 0.5, std::string(i, 'x') });
+
+        double sum = 0;
+        for (double v : table.column<1>())
+            sum += v;
+
+        std::size_t entries = 0;
+        static_ranges::for_each_column(table, [&entries](auto &) { ++entries; });
+
+        table_type doubled;
+        static_ranges::transform_columns(table, doubled, [](const auto & e) { return e + e; });
+
+        return sum == 3.0 && entries == 12 && doubled.size() == 4
+            && doubled.get(3) == record{ 6, 3.0, "xxxxxx" };
+    }
+
+    bool rollback() {
+        using failing_record = std::tuple<int, std::string, throwing_copy>;
+        static_ranges::soa_table<failing_record> table;
+        failing_record r;
+        std::get<1>(r) = "Foo";
+
+        copy_budget = 1;
+        table.push_back(r);
+        try {
+            table.push_back(r);
+            return false;
+        }
+        catch (const std::runtime_error &) {
+        }
+
+        return table.size() == 1 && table.column<0>().size() == 1
+            && table.column<1>().size() == 1 && table.column<2>().size() == 1;
+    }
+
+
+    bool check(bool ok, const char * what) {
+        if (!ok)
+            std::fprintf(stderr, "soa: %s failed\n", what);
+        return ok;
+    }
+
+} // anonymous namespace
+
+
+int main()
+{
+    bool ok = true;
+    ok &= check(rows(), "rows");
+    ok &= check(columns(), "columns");
+    ok &= check(rollback(), "rollback");
+    return ok ? 0 : 1;
+}